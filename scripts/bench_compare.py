@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Compara dos corridas de `make bench` (JSON de build/mis-microbench).
+
+Uso:
+  python3 scripts/bench_compare.py base.json nuevo.json [--threshold 0.05] [--t 3.0]
+
+Para cada (kernel, n, p) presente en ambos archivos imprime ns/op de cada
+corrida, la razón nuevo/base y el estadístico t de Welch. Marca:
+  REGRESION  si la razón > 1 + threshold y |t| >= t
+  MEJORA     si la razón < 1 - threshold y |t| >= t
+Código de salida 1 si hay al menos una regresión (útil en CI).
+"""
+import argparse
+import json
+import math
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    res = {}
+    for r in data["results"]:
+        res[(r["kernel"], r["n"], r["p"])] = r
+    return data.get("meta", {}), res
+
+
+def welch_t(a, b):
+    va = a["variance"] / max(1, a["samples"])
+    vb = b["variance"] / max(1, b["samples"])
+    den = math.sqrt(va + vb)
+    if den == 0:
+        return math.inf if a["ns_per_op"] != b["ns_per_op"] else 0.0
+    return (b["ns_per_op"] - a["ns_per_op"]) / den
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("base")
+    ap.add_argument("new")
+    ap.add_argument("--threshold", type=float, default=0.05)
+    ap.add_argument("--t", type=float, default=3.0)
+    args = ap.parse_args()
+
+    meta_a, A = load(args.base)
+    meta_b, B = load(args.new)
+    print(f"# base: {meta_a.get('git', '?')} {meta_a.get('date', '')}")
+    print(f"# new : {meta_b.get('git', '?')} {meta_b.get('date', '')}")
+    print(f"{'kernel':34s} {'n':>6s} {'p':>5s} {'base ns/op':>14s} {'new ns/op':>14s} "
+          f"{'ratio':>7s} {'t':>8s}  estado")
+
+    regressions = 0
+    for key in sorted(set(A) & set(B)):
+        a, b = A[key], B[key]
+        ratio = b["ns_per_op"] / a["ns_per_op"] if a["ns_per_op"] > 0 else math.inf
+        t = welch_t(a, b)
+        status = ""
+        if abs(t) >= args.t:
+            if ratio > 1 + args.threshold:
+                status = "REGRESION"
+                regressions += 1
+            elif ratio < 1 - args.threshold:
+                status = "MEJORA"
+        kernel, n, p = key
+        print(f"{kernel:34s} {n:6d} {p:5g} {a['ns_per_op']:14.1f} {b['ns_per_op']:14.1f} "
+              f"{ratio:7.3f} {t:8.2f}  {status}")
+
+    only = (set(A) ^ set(B))
+    if only:
+        print(f"# {len(only)} entradas presentes en solo una corrida (omitidas)")
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
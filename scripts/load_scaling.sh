@@ -0,0 +1,40 @@
+#!/usr/bin/env bash
+# Escalamiento de la carga en paralelo (--load_threads) de 1 a 32 hilos
+# Uso:
+#   scripts/load_scaling.sh <instancia.graph> [repeticiones]
+# Salida (CSV en stdout): load_threads,csr_time_s,gb_per_s,speedup
+# (csr_time_s = mediana de las repeticiones del "csr_time" de Greedy --parallel:
+#  archivo -> CSR; gb_per_s = tamaño del archivo / csr_time_s; speedup
+#  respecto de 1 hilo)
+
+set -euo pipefail
+
+FILE="$1"
+REPS="${2:-3}"
+BIN="./build/Greedy"
+
+if [[ ! -x "$BIN" ]]; then
+  echo "No existe ejecutable: $BIN (ejecuta make)" >&2
+  exit 1
+fi
+if [[ ! -f "$FILE" ]]; then
+  echo "No existe archivo de entrada: $FILE" >&2
+  exit 1
+fi
+
+BYTES=$(stat -c %s "$FILE")
+echo "load_threads,csr_time_s,gb_per_s,speedup"
+base=""
+for T in 1 2 4 8 16 32; do
+  times=()
+  for ((r = 0; r < REPS; r++)); do
+    "$BIN" -i "$FILE" --parallel --threads 1 --load_threads "$T" >/dev/null 2>"/tmp/load_$$.err"
+    times+=("$(sed -n 's/.*csr_time=\([0-9.e+-]*\).*/\1/p' "/tmp/load_$$.err")")
+  done
+  med=$(printf '%s\n' "${times[@]}" | sort -g | awk '{a[NR]=$1} END{print a[int((NR+1)/2)]}')
+  [[ -z "$base" ]] && base="$med"
+  gbs=$(awk -v b="$BYTES" -v t="$med" 'BEGIN{ printf "%.3f", (t > 0 ? b / t / 1e9 : 0) }')
+  speedup=$(awk -v b="$base" -v t="$med" 'BEGIN{ printf "%.2f", (t > 0 ? b / t : 0) }')
+  echo "$T,$med,$gbs,$speedup"
+done
+rm -f "/tmp/load_$$.err"
@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+# Escalamiento del Greedy paralelo (Luby) de 1 a 32 hilos
+# Uso:
+#   scripts/luby_scaling.sh <instancia.graph> [random|mindeg] [repeticiones]
+# Salida (CSV en stdout): threads,priority,value,time_s,speedup,rounds
+# (time_s = mediana de las repeticiones; speedup respecto de 1 hilo)
+
+set -euo pipefail
+
+FILE="$1"
+PRIO="${2:-random}"
+REPS="${3:-3}"
+BIN="./build/Greedy"
+
+if [[ ! -x "$BIN" ]]; then
+  echo "No existe ejecutable: $BIN (ejecuta make)" >&2
+  exit 1
+fi
+if [[ ! -f "$FILE" ]]; then
+  echo "No existe archivo de entrada: $FILE" >&2
+  exit 1
+fi
+
+echo "threads,priority,value,time_s,speedup,rounds"
+base=""
+for T in 1 2 4 8 16 32; do
+  times=()
+  for ((r = 0; r < REPS; r++)); do
+    out=$("$BIN" -i "$FILE" --parallel --threads "$T" --priority "$PRIO" 2>"/tmp/luby_$$.err")
+    value=$(awk '{print $1}' <<< "$out")
+    times+=("$(awk '{print $2}' <<< "$out")")
+    rounds=$(sed -n 's/.*rounds=\([0-9]*\).*/\1/p' "/tmp/luby_$$.err")
+  done
+  med=$(printf '%s\n' "${times[@]}" | sort -g | awk '{a[NR]=$1} END{print a[int((NR+1)/2)]}')
+  [[ -z "$base" ]] && base="$med"
+  speedup=$(awk -v b="$base" -v t="$med" 'BEGIN{ printf "%.2f", (t > 0 ? b / t : 0) }')
+  echo "$T,$PRIO,$value,$med,$speedup,$rounds"
+done
+rm -f "/tmp/luby_$$.err"
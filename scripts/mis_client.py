@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Cliente mínimo de mis-server: envía una línea y muestra las respuestas.
+
+Uso: python3 scripts/mis_client.py [--socket /tmp/mis.sock] solve graph=RUTA algo=ga t=5 seed=1
+     python3 scripts/mis_client.py stats
+
+Para "solve" imprime cada "improve" a medida que llega y termina con "done"
+o "error". Ctrl-C cierra la conexión, lo que cancela la solicitud.
+"""
+import socket
+import sys
+
+
+def main():
+    args = sys.argv[1:]
+    path = "/tmp/mis.sock"
+    if len(args) >= 2 and args[0] == "--socket":
+        path, args = args[1], args[2:]
+    if not args:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    s = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    try:
+        s.connect(path)
+    except OSError as e:
+        print(f"ERROR: no pude conectar a {path}: {e}", file=sys.stderr)
+        return 1
+    s.sendall((" ".join(args) + "\n").encode())
+    if args[0] == "shutdown":
+        return 0
+    buf = b""
+    while True:
+        chunk = s.recv(65536)
+        if not chunk:
+            return 1
+        buf += chunk
+        while b"\n" in buf:
+            line, buf = buf.split(b"\n", 1)
+            text = line.decode()
+            print(text, flush=True)
+            if not text.startswith("improve "):
+                return 1 if text.startswith("error ") else 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    except KeyboardInterrupt:
+        sys.exit(130)
@@ -42,62 +42,68 @@ echo
 echo "N,p,time_limit,best_size,best_time,instance" > "$OUT10"
 echo "N,p,time_limit,best_size,best_time,instance" > "$OUT60"
 
-run_set () {
-  local TIME_LIMIT="$1"
-  local OUT_FILE="$2"
-
-  for INST in "${INSTANCES[@]}"; do
-    if [ ! -f "$INST" ]; then
-      echo "ADVERTENCIA: no se encuentra la instancia $INST, se omite."
-      continue
-    fi
-
-    # Extraer N y p desde el nombre del archivo
-    # Ejemplo: erdos_n1000_p0c0.5_1.graph
-    local BASENAME
-    BASENAME="$(basename "$INST")"
-
-    # N: parte después de 'n' hasta '_'
-    local NVAL
-    NVAL="$(echo "$BASENAME" | sed -E 's/.*n([0-9]+)_p.*/\1/')"
-
-    # p: tomar p0c0.5 → 0.5
-    local PVAL
-    PVAL="$(echo "$BASENAME" | sed -E 's/.*p0c0\.([0-9]+).*/0.\1/')"
-
-    echo "======================================================"
-    echo "Instancia : $INST"
-    echo "N         : $NVAL"
-    echo "p         : $PVAL"
-    echo "Tiempo    : $TIME_LIMIT s"
-    echo "Config    : ${IRACE_ARGS[*]}"
-    echo "======================================================"
-
-    # Ejecutar GA y capturar la última línea (any-time)
-    # Formato esperado: "<best_size> <time>"
-    LAST_LINE="$("$GA_BIN" -i "$INST" -t "$TIME_LIMIT" "${IRACE_ARGS[@]}" | tail -n 1 || true)"
-
-    if [ -z "$LAST_LINE" ]; then
-      echo "ADVERTENCIA: ejecución sin salida para $INST (time_limit=$TIME_LIMIT)"
-      continue
-    fi
-
-    BEST_SIZE="$(echo "$LAST_LINE" | awk '{print $1}')"
-    BEST_TIME="$(echo "$LAST_LINE" | awk '{print $2}')"
-
-    echo "  → best_size = $BEST_SIZE, best_time = $BEST_TIME"
-
-    # Añadir fila al CSV
-    echo "${NVAL},${PVAL},${TIME_LIMIT},${BEST_SIZE},${BEST_TIME},${INST}" >> "$OUT_FILE"
-    echo
-  done
+# Una sola corrida de 60 s por instancia: el valor a los 10 s sale del
+# checkpoint "#checkpoint: at=10 best=<v> best_time=<s> ..." (stderr) y el
+# de 60 s de la última línea any-time (stdout).
+run_instance () {
+  local INST="$1"
+
+  if [ ! -f "$INST" ]; then
+    echo "ADVERTENCIA: no se encuentra la instancia $INST, se omite."
+    return
+  fi
+
+  # Extraer N y p desde el nombre del archivo
+  # Ejemplo: erdos_n1000_p0c0.5_1.graph
+  local BASENAME
+  BASENAME="$(basename "$INST")"
+
+  # N: parte después de 'n' hasta '_'
+  local NVAL
+  NVAL="$(echo "$BASENAME" | sed -E 's/.*n([0-9]+)_p.*/\1/')"
+
+  # p: tomar p0c0.5 → 0.5
+  local PVAL
+  PVAL="$(echo "$BASENAME" | sed -E 's/.*p0c0\.([0-9]+).*/0.\1/')"
+
+  echo "======================================================"
+  echo "Instancia : $INST"
+  echo "N         : $NVAL"
+  echo "p         : $PVAL"
+  echo "Tiempo    : 60 s (checkpoint a los 10 s)"
+  echo "Config    : ${IRACE_ARGS[*]}"
+  echo "======================================================"
+
+  local ERR_FILE
+  ERR_FILE="$(mktemp)"
+  # Formato esperado en stdout: "<best_size> <time>"
+  LAST_LINE="$("$GA_BIN" -i "$INST" -t 60 --report_at 10 "${IRACE_ARGS[@]}" 2>"$ERR_FILE" | tail -n 1 || true)"
+  CK_LINE="$(grep '^#checkpoint: at=10 ' "$ERR_FILE" || true)"
+  rm -f "$ERR_FILE"
+
+  if [ -z "$LAST_LINE" ] || [ -z "$CK_LINE" ]; then
+    echo "ADVERTENCIA: ejecución sin salida para $INST"
+    return
+  fi
+
+  BEST10="$(echo "$CK_LINE" | sed -E 's/.* best=([0-9]+).*/\1/')"
+  TIME10="$(echo "$CK_LINE" | sed -E 's/.* best_time=([0-9.]+).*/\1/')"
+  BEST60="$(echo "$LAST_LINE" | awk '{print $1}')"
+  TIME60="$(echo "$LAST_LINE" | awk '{print $2}')"
+
+  echo "  → 10s: best_size = $BEST10, best_time = $TIME10"
+  echo "  → 60s: best_size = $BEST60, best_time = $TIME60"
+
+  # Añadir filas a los CSV
+  echo "${NVAL},${PVAL},10,${BEST10},${TIME10},${INST}" >> "$OUT10"
+  echo "${NVAL},${PVAL},60,${BEST60},${TIME60},${INST}" >> "$OUT60"
+  echo
 }
 
-echo "=== Ejecutando GA con 10s en mini-muestra ==="
-run_set 10 "$OUT10"
-
-echo "=== Ejecutando GA con 60s en mini-muestra ==="
-run_set 60 "$OUT60"
+echo "=== Ejecutando GA (60s, checkpoint a 10s) en mini-muestra ==="
+for INST in "${INSTANCES[@]}"; do
+  run_instance "$INST"
+done
 
 echo
 echo "Listo."
@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+# Prueba de --mem_limit con ids enormes: un archivo sin cabecera (dialecto
+# del SA) con un id de 1.5·10^9 debe fallar limpio con "--mem_limit: ..."
+# antes de reservar el contador de grados por id, no crecer a GB de RSS.
+# Cubre la pasada secuencial (archivo chico) y la paralela (>= 1 MB,
+# --load_threads 4). La memoria virtual se acota con ulimit -v: si el
+# cargador reservara por el id, el proceso moriría en vez de salir con 1.
+# Uso:
+#   scripts/test_mem_limit.sh        (lo corre "make test")
+
+set -euo pipefail
+
+BIN="./build/SA"
+if [[ ! -x "$BIN" ]]; then
+  echo "No existe ejecutable: $BIN (ejecuta make)" >&2
+  exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+printf '0 1500000000\n1 2\n' > "$TMP/chico.graph"
+{
+  for ((i = 0; i < 120000; i++)); do echo "$i $((i + 1))"; done
+  echo "0 1500000000"
+} > "$TMP/grande.graph"
+
+fail=0
+for G in chico grande; do
+  set +e
+  out=$( (ulimit -v 1048576; "$BIN" -i "$TMP/$G.graph" -t 1 --mem_limit 64M --load_threads 4) 2>&1)
+  rc=$?
+  set -e
+  if [[ "$rc" -ne 1 ]] || ! grep -q -- "--mem_limit:" <<< "$out"; then
+    echo "FALLA $G.graph: rc=$rc, se esperaba un error de --mem_limit" >&2
+    echo "$out" | tail -3 >&2
+    fail=1
+  else
+    echo "ok $G.graph: $(grep -- "--mem_limit:" <<< "$out")"
+  fi
+done
+exit $fail
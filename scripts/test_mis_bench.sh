@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+# Prueba del prefetch de mis-bench: con --prefetch 0 y 1 el driver termina
+# (no se queda esperando a sí mismo), escribe todas las corridas y las
+# instancias se solapan (3 instancias × 1 corrida de 1 s en 4 hilos: ~1 s de
+# pared, no 3).
+# Uso:
+#   scripts/test_mis_bench.sh        (lo corre "make test")
+
+set -euo pipefail
+
+BIN="./build/mis-bench"
+if [[ ! -x "$BIN" ]]; then
+  echo "No existe ejecutable: $BIN (ejecuta make)" >&2
+  exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+printf 'gen:300,0.05,1\ngen:300,0.05,2\ngen:300,0.05,3\n' > "$TMP/lista.txt"
+
+fail=0
+for PF in 0 1; do
+  OUT="$TMP/pf$PF"
+  t0=$(date +%s%N)
+  if ! timeout 30 "$BIN" -l "$TMP/lista.txt" -a sa -t 1 --seeds 1 --threads 4 \
+        --prefetch "$PF" --outdir "$OUT" > /dev/null 2>&1; then
+    echo "FALLA --prefetch $PF: no terminó o salió con error" >&2
+    fail=1
+    continue
+  fi
+  wall_ms=$(( ($(date +%s%N) - t0) / 1000000 ))
+  runs=$(($(wc -l < "$OUT/runs.csv") - 1))
+  if [[ "$runs" -ne 3 ]]; then
+    echo "FALLA --prefetch $PF: $runs corridas en runs.csv (se esperaban 3)" >&2
+    fail=1
+  elif (( wall_ms > 2500 )); then
+    echo "FALLA --prefetch $PF: wall=${wall_ms} ms, las instancias no se solaparon" >&2
+    fail=1
+  else
+    echo "ok --prefetch $PF: wall=${wall_ms} ms"
+  fi
+done
+exit $fail
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+"""Convierte una traza binaria de --trace (MISTRC01) a CSV time,value,work.
+
+Uso: python3 scripts/trace_to_csv.py traza.bin [salida.csv]
+"""
+import struct
+import sys
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    if data[:8] != b"MISTRC01":
+        print("ERROR: no es una traza MISTRC01", file=sys.stderr)
+        return 1
+    out = open(sys.argv[2], "w") if len(sys.argv) > 2 else sys.stdout
+    out.write("time,value,work\n")
+    for t, work, value, _ in struct.iter_unpack("<dqii", data[8:]):
+        out.write(f"{t:.6f},{value},{work}\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,7 +10,13 @@
 // Uso (CLI):
 //   ./build/SA -i <graph_file> -t <seconds>
 //              [--seed S] [--T0 1.0] [--alpha 0.999] [--iters_per_T N] [--check]
-//              [--diversify] [--adaptive_temp]
+//              [--diversify] [--adaptive_temp] [--target K]
+//              [--split] [--threads T] [--exact_max K]
+//              [--report_at 1,5,10,60] [--stats json] [--perf] [--trace FILE]
+//              [--width auto|32] [--reorder degree|rcm|bfs|none] [--hugepages]
+//              [--mem_limit 8G] [--load_threads T]
+//              [--init_sol ruta.txt] [--best_known DIR] [--out_sol ruta.txt]
+//   (--gen n,p,seed en lugar de -i genera un G(n,p) en memoria, gen/gnp.hpp)
 //
 // Ejemplo:
 //   ./build/SA -i data/.../erdos_n1000_p0c0.05_1.graph -t 5 --seed 1 --diversify
@@ -21,578 +27,60 @@
 //   • Control de temperatura adaptativo basado en tasa de aceptación
 //   • Optimizaciones de memoria para mejor rendimiento en grafos grandes
 //   • Estadísticas detalladas de rendimiento (opcional)
+//   • Término anticipado al alcanzar la cota superior (bounds.hpp) o --target;
+//     con --target la línea final agrega el gap: "<mejor> <tiempo> <gap>"
+//   • --split: resuelve cada componente conexa por separado (components.hpp);
+//     pequeñas con B&B exacto, grandes con SA en un pool de --threads hilos
+//   • --report_at: "#checkpoint: ..." en stderr en cada instante pedido y
+//     "#convergence: ..." (integral primal, time-to-target) al terminar
+//   • --stats json: una línea JSON en stderr con tiempos por fase, contadores
+//     de movimientos, pico de RSS y reservas de memoria (telemetry.hpp)
+//   • --perf: agrega contadores de hardware (ciclos, IPC, fallos L1/LLC y de
+//     saltos) por fase y por movimiento; implica --stats json
+//   • Las líneas any-time las escribe un hilo reportero (trace.hpp): el bucle
+//     de búsqueda no hace E/S. --trace FILE (.csv o binario) guarda además
+//     (tiempo, valor, movimientos) de cada mejora
+//   • --width auto: ids de vértice y contadores conf de 16 bits cuando el
+//     grafo lo permite (index_width.hpp); --width 32 usa ints
+//   • --reorder: reetiqueta los vértices al cargar para que los vecinos
+//     queden cerca en memoria (reorder.hpp); la solución vuelve a los ids
+//     originales antes de --check
+//   • --hugepages: estado por vértice en páginas de 2 MB y heap del grafo
+//     compactado a páginas grandes (hugepages.hpp); "#hugepages: ..." en stderr
+//   • --mem_limit 8G: aborta antes de reservar si el grafo no entra
+//     (graph_load.hpp); la carga es en dos pasadas, sin copia cruda
+//   • --load_threads T: hilos de la carga (0 = uno por núcleo, por defecto;
+//     1 = secuencial); mismo grafo con cualquier T
+//   • --init_sol: arranca desde una solución previa (1-indexed, la de
+//     --out_sol) en lugar del greedy; se repara si no es independiente.
+//     --best_known DIR: almacén de mejores conocidas por hash del grafo
+//     (solution_io.hpp); sin --init_sol arranca desde lo guardado y al
+//     terminar lo reemplaza si la corrida lo supera
+//   • --cache DIR: guarda el orden de --reorder, las cotas y, con --split, las
+//     componentes que cerró el B&B, y los reusa (mapeados) en la próxima
+//     corrida sobre el mismo grafo (artifact_cache.hpp)
+//   • -t lo vigila un hilo (deadline.hpp) que levanta el flag de parada del
+//     motor; SIGINT / SIGTERM también, y la corrida termina con la línea
+//     final y --out_sol (código 128 + señal). "#deadline: ..overrun=.." en
+//     stderr mide cuánto se pasó de -t
 // ============================================================================
 
 #include <bits/stdc++.h>
+#include "SA.hpp"
+#include "gen/gnp.hpp"
+#include "telemetry.hpp"
+#include "pipeline.hpp"
 using namespace std;
+using namespace sa;
 
-// ----------------------------
-// Estructura de grafo optimizada
-// ----------------------------
-struct Graph {
-    int n = 0;
-    vector<vector<int>> adj;
-    vector<int> degree;  // Precalculamos grados para optimización
-    
-    void compute_degrees() {
-        degree.resize(n);
-        for (int v = 0; v < n; ++v) {
-            degree[v] = (int)adj[v].size();
-        }
-    }
-};
-
-// -----------------------------------------------------------------------------
-// read_graph(path)
-// Lee un grafo no dirigido desde archivo. Soporta:
-//   - Línea cabecera "p edge n m" (DIMACS-like)
-//   - Pares "u v" uno por línea (0-based o 1-based)
-// El detector one_based convierte a 0-based si corresponde. Elimina duplicados.
-// Lanza std::runtime_error si no puede abrirse el archivo o si no hay datos.
-// -----------------------------------------------------------------------------
-Graph read_graph(const string& path) {
-    ifstream fin(path);
-    if (!fin) throw runtime_error("Cannot open file: " + path);
-
-    string line;
-    long long header_n = -1;
-    vector<pair<int,int>> edges;
-    long long max_node = -1;
-
-    while (getline(fin, line)) {
-        if (line.empty()) continue;
-        // Trim leading spaces
-        size_t i = 0; while (i < line.size() && isspace((unsigned char)line[i])) ++i;
-        if (i >= line.size()) continue;
-
-        char c = line[i];
-        // Comentarios comunes en grafos
-        if (c=='c' || c=='C' || c=='#' || c=='%' || c=='/') {
-            continue;
-        }
-        if (c=='p' || c=='P') {
-            // Espera: "p edge n m"
-            string tag, kind;
-            long long n=-1, m=-1;
-            stringstream ss(line);
-            ss >> tag >> kind >> n >> m;
-            if (n>0) header_n = n;
-            /*if (m>=0) header_m = m;*/
-            continue;
-        }
-        // Intentar parsear dos enteros
-        stringstream ss(line);
-        long long a, b;
-        if (ss >> a >> b) {
-            // Validación adicional para evitar valores extremos
-            if (a >= 0 && b >= 0 && a < 1000000 && b < 1000000) {
-                edges.emplace_back((int)a, (int)b);
-                max_node = max(max_node, max(a, b));
-            } else {
-                cerr << "[WARN] Ignorando arista con valores extremos: " << a << " " << b << "\n";
-            }
-        } else {
-            // Formatos no soportados (p.ej., listas de adyacencia), se ignoran
-            continue;
-        }
-    }
-    fin.close();
-
-    // Detectar 1-based vs 0-based usando las aristas leídas 
-    bool has_zero = false, has_one = false;
-    for (auto &e : edges) {
-        if (e.first == 0 || e.second == 0) has_zero = true;
-        if (e.first == 1 || e.second == 1) has_one  = true;
-    }
-    bool one_based = (!has_zero && has_one);
-
-    // Fijar n 
-    int n = 0;
-    if (header_n > 0) {
-        n = (int)header_n;
-    } else {
-        // Inferir n desde el índice máximo observado
-        if (max_node < 0) throw runtime_error("Graph seems empty or unrecognized format.");
-        // 0-based => max_index + 1 ; 1-based => max_index (porque luego normalizamos a 0-based)
-        n = (int)max_node + (one_based ? 0 : 1);
-    }
-
-    // Construir grafo
-    Graph G;
-    G.n = n;
-    G.adj.assign(n, {});
-
-    auto add_edge_undirected = [&](int u, int v) {
-        if (u == v) return;          // ignorar loops
-        if (u < 0 || v < 0 || u >= G.n || v >= G.n) return; // sanity
-        G.adj[u].push_back(v);
-        G.adj[v].push_back(u);
-    };
-
-
-    for (auto &e : edges) {
-        int u = e.first;
-        int v = e.second;
-        if (one_based) { u--; v--; }   // normalizar a 0-based si corresponde
-        if (u<0 || v<0 || u>=n || v>=n) continue;
-        if (u == v) continue;              // evita loops
-        if (u > v) swap(u, v);             // normaliza par
-        add_edge_undirected(u,v);
-    }
-
-    // Deduplicar vecinos
-    for (int u=0; u<n; ++u) {
-        auto &nbr = G.adj[u];
-        sort(nbr.begin(), nbr.end());
-        nbr.erase(unique(nbr.begin(), nbr.end()), nbr.end());
-    }
-    return G;
-}
-
-// ----------------------------
-// Temporizador mejorado con estadísticas
-// ----------------------------
-struct Timer {
-    chrono::steady_clock::time_point t0;
-    Timer() { reset(); }
-    void reset() { t0 = chrono::steady_clock::now(); }
-    double elapsed() const {
-        auto now = chrono::steady_clock::now();
-        chrono::duration<double> diff = now - t0;
-        return diff.count();
-    }
-};
-
-// ============================================================================
-// MIS_SA_OPTIMIZED: versión mejorada del Recocido Simulado para MIS
-// ----------------------------------------------------------------------------
-struct MIS_SA {
-    const Graph& G;
-    vector<char> inS;       // 1 si v está en S
-    vector<int>  conf;      // conflictos: vecinos de v en S
-    int curr_size = 0;
-
-    int best_size = 0;
-    vector<char> best_inS;
-    double best_time = 0.0;
-
-    // Nuevas estructuras para optimización
-    vector<int> candidates;     // Lista de candidatos para movimientos
-    vector<char> is_candidate;  // Marcador rápido de candidatos
-    vector<int> vertex_priority; // Prioridad de vértices para diversificación
-    
-    // Estadísticas de rendimiento
-    long long total_moves = 0;
-    long long accepted_moves = 0;
-    long long improvements = 0;
-    int stagnation_count = 0;
-    double last_improvement_time = 0.0;
-    
-    // Parámetros adaptativos
-    bool use_diversification = false;
-    bool use_adaptive_temp = false;
-    bool verbose = false;  // Nuevo: para logging detallado
-    double acceptance_rate = 0.0;
-    
-    mt19937_64 rng;
-    uniform_real_distribution<double> U01;
-    uniform_int_distribution<int> Uv;
-
-    MIS_SA(const Graph& G_, uint64_t seed)
-        : G(G_), inS(G_.n, 0), conf(G_.n, 0), best_inS(G_.n, 0),
-          candidates(), is_candidate(G_.n, 0), vertex_priority(G_.n, 0),
-          rng(seed), U01(0.0,1.0), Uv(0, max(0, G_.n-1)) {
-        
-        // Pre-reservar memoria para estructuras dinámicas
-        candidates.reserve(G_.n);
-        
-        // Inicializar prioridades de vértices (para diversificación)
-        for (int v = 0; v < G.n; ++v) {
-            vertex_priority[v] = G.degree[v];
-        }
-    }
-
-    // Agrega v a S y actualiza conflictos
-    void add_vertex(int v) {
-        inS[v] = 1;
-        ++curr_size;
-        for (int w : G.adj[v]) conf[w]++;
-    }
-    // Quita v de S y actualiza conflictos
-    void remove_vertex(int v) {
-        inS[v] = 0;
-        --curr_size;
-        for (int w : G.adj[v]) conf[w]--;
-    }
-
-    // Actualizar lista de candidatos de manera eficiente
-    void update_candidates() {
-        candidates.clear();
-        // Reservar espacio conservadoramente 
-        int estimated_candidates = max(1, G.n - curr_size);
-        candidates.reserve(estimated_candidates);
-        
-        for (int v = 0; v < G.n; ++v) {
-            if (!inS[v]) {
-                candidates.push_back(v);
-                is_candidate[v] = 1;
-            } else {
-                is_candidate[v] = 0;
-            }
-        }
-        
-        // Mezclar candidatos para evitar sesgos
-        shuffle(candidates.begin(), candidates.end(), rng);
-    }
-
-    // Inicialización greedy mejorada con múltiples criterios
-    void init_greedy_maximal_improved() {
-        int n = G.n;
-        vector<int> order(n);
-        iota(order.begin(), order.end(), 0);
-        
-        // Ordenar por múltiples criterios: grado, luego por ID para desempate
-        sort(order.begin(), order.end(), [&](int a, int b) {
-            if (G.degree[a] != G.degree[b]) 
-                return G.degree[a] < G.degree[b];
-            return a < b; // Desempate determinístico
-        });
-
-        // Aplicar greedy con mejora local
-        for (int v : order) {
-            if (!inS[v] && conf[v] == 0) {
-                add_vertex(v);
-                
-                // Micro-optimización: intentar agregar vecinos de bajo grado
-                vector<int> low_degree_neighbors;
-                for (int u : G.adj[v]) {
-                    if (!inS[u] && conf[u] == 0 && G.degree[u] <= 3) {
-                        low_degree_neighbors.push_back(u);
-                    }
-                }
-                
-                for (int u : low_degree_neighbors) {
-                    if (!inS[u] && conf[u] == 0) {
-                        add_vertex(u);
-                    }
-                }
-            }
-        }
-        
-        update_candidates();
-        best_size = curr_size;
-        best_inS = inS;
-        best_time = 0.0;
-    }
-
-    // Completar a maximal (añade cualquier v con conf[v]==0)
-    void complete_to_maximal() {
-        bool added = true;
-        while (added) {
-            added = false;
-            for (int v=0; v<G.n; ++v) {
-                if (!inS[v] && conf[v]==0) {
-                    add_vertex(v);
-                    added = true;
-                }
-            }
-        }
-    }
-
-    // Versión local: completa a maximal solo en la región afectada
-    void complete_to_maximal_local(const std::vector<int>& frontier_in) {
-        std::deque<int> q;
-        q.insert(q.end(), frontier_in.begin(), frontier_in.end());
-        std::vector<char> inQueue(G.n, 0);
-        for (int x : frontier_in)
-            if (0 <= x && x < G.n)
-                inQueue[x] = 1;
-
-        while (!q.empty()) {
-            int x = q.front();
-            q.pop_front();
-            inQueue[x] = 0;
-
-            // Si x no está en S y no tiene vecinos en S, se puede agregar
-            if (!inS[x] && conf[x] == 0) {
-                add_vertex(x);
-                // Al añadir x, sus vecinos podrían volverse candidatos
-                for (int w : G.adj[x]) {
-                    if (!inQueue[w]) {
-                        q.push_back(w);
-                        inQueue[w] = 1;
-                    }
-                }
-            }
-        }
-    }
-
-    // Registra mejor solución con estadísticas mejoradas
-    void maybe_record_best(double elapsed_sec) {
-        if (curr_size > best_size) {
-            best_size = curr_size;
-            best_inS = inS;
-            best_time = elapsed_sec;
-            last_improvement_time = elapsed_sec;
-            improvements++;
-            stagnation_count = 0;
-            
-            cout.setf(std::ios::fixed);
-            cout << setprecision(6) << best_size << " " << best_time << "\n";
-            cout.flush();
-        }
-    }
-
-    // Estrategia de diversificación cuando hay estancamiento
-    void diversify_solution() {
-        if (!use_diversification) return;
-        
-        int original_size = curr_size;
-        
-        // Crear lista de vértices en S ordenados por prioridad
-        vector<pair<int, int>> vertices_with_priority;
-        vertices_with_priority.reserve(curr_size);
-        
-        for (int v = 0; v < G.n; ++v) {
-            if (inS[v]) {
-                vertices_with_priority.emplace_back(vertex_priority[v], v);
-            }
-        }
-        
-        // Ordenar por prioridad (más alta primero)
-        sort(vertices_with_priority.begin(), vertices_with_priority.end(), 
-             greater<pair<int, int>>());
-        
-        // Remover hasta 20% de los vértices con mayor prioridad
-        int to_remove = min((int)vertices_with_priority.size(), 
-                           max(1, curr_size / 5));
-        
-        for (int i = 0; i < to_remove; ++i) {
-            int v = vertices_with_priority[i].second;
-            remove_vertex(v);
-        }
-        
-        // Completar a maximal
-        complete_to_maximal();
-        update_candidates();
-        
-        if (verbose) {
-            cerr << "#diversify: removed=" << to_remove 
-                 << " size " << original_size << "->" << curr_size << "\n";
-        }
-        
-        // Reiniciar prioridades gradualmente (no completamente)
-        for (int v = 0; v < G.n; ++v) {
-            vertex_priority[v] = (vertex_priority[v] + G.degree[v]) / 2;
-        }
-    }
-
-    // Control de temperatura adaptativo
-    double adaptive_temperature_update(double T, double target_acceptance = 0.4) {
-        if (!use_adaptive_temp) return T * 0.9995; // Comportamiento original
-        
-        const double tolerance = 0.05;
-        const double fast_cooling = 0.985;
-        const double normal_cooling = 0.9995;
-        const double slow_cooling = 0.9999;
-        
-        if (acceptance_rate > target_acceptance + tolerance) {
-            // Demasiadas aceptaciones -> enfriar más rápido
-            return T * fast_cooling;
-        } else if (acceptance_rate < target_acceptance - tolerance) {
-            // Muy pocas aceptaciones -> enfriar más lento
-            return T * slow_cooling;
-        } else {
-            // En el rango objetivo -> enfriamiento normal
-            return T * normal_cooling;
-        }
-    }
-
-    // Bucle principal optimizado con mejoras adaptativas
-    void run(double tmax, double T0, double alpha, int iters_per_T) {
-        Timer tim;
-        init_greedy_maximal_improved();  // Inicialización mejorada
-        
-        // Ajuste dinámico más inteligente
-        if (iters_per_T <= 0 || iters_per_T == 1000) {
-            iters_per_T = max(1000, min(10000, G.n * 3));
-        }
-
-        maybe_record_best(0.0);
-
-        double T = T0;
-        if (G.n == 0) return;
-
-        long long moves_in_block = 0;
-        long long accepted_in_block = 0;
-
-        while (true) {
-            double el = tim.elapsed();
-            if (el >= tmax) break;
-
-            // Verificar estancamiento para diversificación
-            if (use_diversification && el - last_improvement_time > tmax * 0.1) {
-                stagnation_count++;
-                if (stagnation_count >= 3) {
-                    diversify_solution();
-                    maybe_record_best(tim.elapsed());
-                    stagnation_count = 0;
-                    last_improvement_time = el;
-                }
-            }
-
-            moves_in_block = 0;
-            accepted_in_block = 0;
-
-            // Bloque de iteraciones por temperatura
-            for (int it = 0; it < iters_per_T; ++it) {
-                if ((it & 511) == 0) {  // Chequeo más frecuente
-                    el = tim.elapsed();
-                    if (el >= tmax) break;
-                }
-
-                // Selección de vértice optimizada
-                if (candidates.empty()) update_candidates();
-                
-                int v = -1;
-                if (!candidates.empty() && U01(rng) < 0.8) {
-                    // 80% del tiempo: usar candidatos precalculados
-                    int idx = uniform_int_distribution<int>(0, (int)candidates.size()-1)(rng);
-                    v = candidates[idx];
-                    
-                    // Optimización: remover candidato usado para evitar repetición inmediata
-                    if (candidates.size() > 10) { // Solo si hay suficientes candidatos
-                        swap(candidates[idx], candidates.back());
-                        candidates.pop_back();
-                    }
-                } else {
-                    // 20% del tiempo: selección completamente aleatoria
-                    for (int tries = 0; tries < 16; ++tries) {
-                        v = Uv(rng);
-                        if (!inS[v]) break;
-                    }
-                    if (inS[v]) continue;
-                }
-
-                int k = conf[v];
-                int delta = 1 - k;
-                bool accept = (delta >= 0);
-                
-                moves_in_block++;
-                total_moves++;
-
-                if (!accept && T > 1e-9) {
-                    double prob = exp(delta / T);
-                    accept = (U01(rng) < prob);
-                }
-
-                if (accept) {
-                    accepted_in_block++;
-                    accepted_moves++;
-                    
-                    // Actualizar prioridad del vértice seleccionado
-                    vertex_priority[v]++;
-                    
-                    // Aplicar movimiento
-                    vector<int> removed;
-                    for (int u : G.adj[v]) {
-                        if (inS[u]) {
-                            remove_vertex(u);
-                            removed.push_back(u);
-                            // Decrementar prioridad de vértices removidos
-                            vertex_priority[u] = max(0, vertex_priority[u] - 1);
-                        }
-                    }
-
-                    add_vertex(v);
-
-                    // Construcción de frontera optimizada con estimación más precisa
-                    int frontier_capacity = 1 + removed.size();
-                    for (int u : removed) {
-                        frontier_capacity += min(G.degree[u], G.n); // Limitar para evitar overflow
-                    }
-                    frontier_capacity += min(G.degree[v], G.n);
-                    frontier_capacity = min(frontier_capacity, G.n * 2); // Limitar máximo
-                    
-                    vector<int> frontier;
-                    frontier.reserve(frontier_capacity);
-                    
-                    frontier.push_back(v);
-                    frontier.insert(frontier.end(), removed.begin(), removed.end());
-                    for (int u : removed) {
-                        frontier.insert(frontier.end(), G.adj[u].begin(), G.adj[u].end());
-                    }
-                    frontier.insert(frontier.end(), G.adj[v].begin(), G.adj[v].end());
-
-                    complete_to_maximal_local(frontier);
-                    maybe_record_best(tim.elapsed());
-                    
-                    // Actualizar candidatos si es necesario
-                    if (it % 100 == 0) update_candidates();
-                }
-            }
-
-            // Calcular tasa de aceptación para control adaptativo
-            if (moves_in_block > 0) {
-                acceptance_rate = 0.9 * acceptance_rate + 
-                                0.1 * (double(accepted_in_block) / moves_in_block);
-            }
-
-            // Actualización de temperatura (adaptativa o fija)
-            if (use_adaptive_temp) {
-                T = adaptive_temperature_update(T);
-            } else {
-                T *= alpha;
-            }
-            
-            if (T < 1e-12) T = 1e-12;
-        }
-
-        // Estadísticas finales (enviadas a stderr para no interferir con salida)
-        if (total_moves > 0) {
-            double final_acceptance_rate = double(accepted_moves) / total_moves;
-            double avg_moves_per_second = total_moves / tim.elapsed();
-            
-            cerr << "#stats: total_moves=" << total_moves 
-                 << " accepted=" << accepted_moves 
-                 << " rate=" << fixed << setprecision(3) << final_acceptance_rate
-                 << " improvements=" << improvements 
-                 << " moves_per_sec=" << fixed << setprecision(0) << avg_moves_per_second
-                 << "\n";
-        }
-
-        // Repetir mejor línea al final
-        cout.setf(std::ios::fixed);
-        cout << setprecision(6) << best_size << " " << best_time << "\n";
-        cout.flush();
-    }
-};
-
-// -----------------------------------------------------------------------------
-// Validadores de la mejor solución (opcionales, activados con --check)
-//   - is_independent: no hay aristas internas en S
-//   - is_maximal    : no se puede agregar ningún vértice sin romper independencia
-// -----------------------------------------------------------------------------
-static bool is_independent(const Graph& G, const vector<char>& inS) {
-    for (int u = 0; u < G.n; ++u) if (inS[u]) {
-        for (int v : G.adj[u]) if (inS[v]) return false;
-    }
-    return true;
-}
-static bool is_maximal(const Graph& G, const vector<char>& inS) {
-    for (int u = 0; u < G.n; ++u) if (!inS[u]) {
-        bool ok = true;
-        for (int v : G.adj[u]) if (inS[v]) { ok = false; break; }
-        if (ok) return false; // se podría agregar u ⇒ no es maximal
-    }
-    return true;
-}
+TEL_DEFINE_ALLOC_HOOKS()
 
 // ----------------------
 // CLI mejorado con nuevas opciones
 // ----------------------
 struct Args {
     string   infile;
+    string   gen;               // "n,p,seed": G(n,p) en memoria
     double   tmax = 5.0;
     uint64_t seed = (uint64_t)chrono::high_resolution_clock::now().time_since_epoch().count();
     double   T0   = 2.0;        // Temperatura inicial más alta
@@ -602,6 +90,23 @@ struct Args {
     bool     diversify = false;    // Nueva: activar diversificación
     bool     adaptive_temp = false; // Nueva: control de temperatura adaptativo
     bool     verbose = false;      // Nueva: modo verbose para debugging
+    int      target = -1;          // Detener al alcanzar este valor
+    bool     split = false;        // Resolver por componentes conexas
+    int      threads = max(1, (int)thread::hardware_concurrency());
+    int      exact_max = 64;       // Componentes <= exact_max: B&B exacto
+    vector<double> report_at;      // Instantes de checkpoint (segundos)
+    string   stats;                // --stats json: telemetría por fases
+    bool     perf = false;         // --perf: contadores de hardware
+    string   trace;                // --trace FILE: eventos any-time
+    string   width = "auto";       // --width auto|32: ancho de ids / conf
+    string   reorder = "none";     // --reorder degree|rcm|bfs|none
+    bool     hugepages = false;    // --hugepages: arena de páginas de 2 MB
+    size_t   mem_limit = 0;        // --mem_limit: bytes (0 = sin límite)
+    int      load_threads = 0;     // --load_threads: 0 = uno por núcleo
+    string   init_sol;             // --init_sol: solución de arranque (1-indexed)
+    string   best_known;           // --best_known DIR: almacén por instancia
+    string   out_sol;              // --out_sol: mejor solución (1-indexed)
+    string   cache;                // --cache DIR: artefactos de preprocesamiento
 };
 
 // Parseo mejorado con nuevas opciones
@@ -610,11 +115,29 @@ Args parse_args(int argc, char** argv) {
     for (int i=1; i<argc; ++i) {
         string s = argv[i];
         if      (s=="-i"            && i+1<argc) a.infile = argv[++i];
+        else if (s=="--gen"         && i+1<argc) a.gen = argv[++i];
         else if (s=="-t"            && i+1<argc) a.tmax = stod(argv[++i]);
         else if (s=="--seed"        && i+1<argc) a.seed = stoull(argv[++i]);
         else if (s=="--T0"          && i+1<argc) a.T0 = stod(argv[++i]);
         else if (s=="--alpha"       && i+1<argc) a.alpha = stod(argv[++i]);
         else if (s=="--iters_per_T" && i+1<argc) a.iters_per_T = stoi(argv[++i]);
+        else if (s=="--target"      && i+1<argc) a.target = stoi(argv[++i]);
+        else if (s=="--threads"     && i+1<argc) a.threads = stoi(argv[++i]);
+        else if (s=="--exact_max"   && i+1<argc) a.exact_max = stoi(argv[++i]);
+        else if (s=="--report_at"   && i+1<argc) a.report_at = parse_report_at(argv[++i]);
+        else if (s=="--stats"       && i+1<argc) a.stats = argv[++i];
+        else if (s=="--trace"       && i+1<argc) a.trace = argv[++i];
+        else if (s=="--width"       && i+1<argc) a.width = argv[++i];
+        else if (s=="--reorder"     && i+1<argc) a.reorder = argv[++i];
+        else if (s=="--mem_limit"   && i+1<argc) a.mem_limit = parse_mem_limit(argv[++i]);
+        else if (s=="--load_threads"&& i+1<argc) a.load_threads = stoi(argv[++i]);
+        else if (s=="--init_sol"    && i+1<argc) a.init_sol = argv[++i];
+        else if (s=="--best_known"  && i+1<argc) a.best_known = argv[++i];
+        else if (s=="--out_sol"     && i+1<argc) a.out_sol = argv[++i];
+        else if (s=="--cache"       && i+1<argc) a.cache = argv[++i];
+        else if (s=="--split") a.split = true;
+        else if (s=="--perf") a.perf = true;
+        else if (s=="--hugepages") a.hugepages = true;
         else if (s=="--check") a.do_check = true;
         else if (s=="--diversify") a.diversify = true;
         else if (s=="--adaptive_temp") a.adaptive_temp = true;
@@ -624,9 +147,15 @@ Args parse_args(int argc, char** argv) {
             exit(1);
         }
     }
-    if (a.infile.empty()) {
-        cerr << "Usage: SA -i <graph_file> -t <seconds> [--seed S] [--T0 2.0] [--alpha 0.9995]\n"
-             << "          [--iters_per_T N] [--check] [--diversify] [--adaptive_temp] [--verbose]\n";
+    if (a.infile.empty() && a.gen.empty()) {
+        cerr << "Usage: SA -i <graph_file>|--gen n,p,seed -t <seconds> [--seed S] [--T0 2.0] [--alpha 0.9995]\n"
+             << "          [--iters_per_T N] [--check] [--diversify] [--adaptive_temp] [--verbose]\n"
+             << "          [--target K] [--split] [--threads T] [--exact_max K]\n"
+             << "          [--report_at 1,5,10,60] [--stats json] [--perf]\n"
+             << "          [--trace FILE] [--width auto|32] [--reorder degree|rcm|bfs|none]\n"
+             << "          [--hugepages] [--mem_limit 8G] [--load_threads T]\n"
+             << "          [--init_sol ruta.txt] [--best_known DIR] [--out_sol ruta.txt]\n"
+             << "          [--cache DIR]\n";
         exit(1);
     }
     
@@ -638,47 +167,129 @@ Args parse_args(int argc, char** argv) {
         a.alpha = 0.9995;
     }
     if (a.iters_per_T <= 0) a.iters_per_T = 1000;
+    if (a.threads <= 0) a.threads = 1;
     
     return a;
 }
 
+// --split: un MIS_SA por componente grande, ensamblado por solve_by_components
+static LargeSolver sa_large_solver(const Args& args) {
+    return [&args](const vector<vector<int>>& sub, double budget, unsigned seed,
+                   int comp_stop, const atomic<bool>* stop,
+                   const function<void(int)>& on_improve) {
+        Graph Gc;
+        Gc.n = (int)sub.size();
+        Gc.adj = sub;
+        Gc.compute_degrees();
+        MIS_SA s(Gc, seed);
+        s.quiet = true;
+        s.use_diversification = args.diversify;
+        s.use_adaptive_temp = args.adaptive_temp;
+        s.stop_at = comp_stop;
+        s.stop_flag = stop;
+        s.on_improve = [&](int v, double) { on_improve(v); };
+        s.run(budget, args.T0, args.alpha, args.iters_per_T);
+        return s.best_inS;
+    };
+}
+
+// Flags comunes a SA, GA y solver_MISP (pipeline.hpp)
+static PipelineOptions pipeline_options(const Args& a) {
+    PipelineOptions O;
+    O.tmax = a.tmax;
+    O.target = a.target;
+    O.seed = (unsigned)a.seed;
+    O.threads = a.threads;
+    O.exact_max = a.exact_max;
+    O.reorder = a.reorder;
+    O.width = a.width;
+    O.report_at = a.report_at;
+    O.trace = a.trace;
+    O.init_sol = a.init_sol;
+    O.best_known = a.best_known;
+    O.cache = a.cache;
+    O.out_sol = a.out_sol;
+    return O;
+}
+
 int main(int argc, char** argv) {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
     try {
         Args args = parse_args(argc, argv);
-        Graph G = read_graph(args.infile);
+        if (!tel::enable("SA", args.stats, args.perf)) {
+            cerr << "--stats: formato no soportado (solo json)\n";
+            return 1;
+        }
+        if (args.hugepages) huge::enable();
+        set_load_threads(args.load_threads);
+        Graph G;
+        if (!args.gen.empty()) {
+            GenSpec gs = parse_gen_spec(args.gen);
+            G.n = gs.n;
+            G.adj = gnp_adjacency(gs, nullptr, args.mem_limit);
+        } else {
+            G = read_graph(args.infile, args.mem_limit);
+        }
+        // Hash, --best_known, --cache, --init_sol, --reorder y cotas (pipeline.hpp)
+        SolverPipeline<vector<char>> P(pipeline_options(args), AnytimeReporter::FIXED6);
+        P.prepare(G.n, G.adj);
         G.compute_degrees();  // Precalcular grados para optimización
 
-        MIS_SA solver(G, args.seed);
-        solver.use_diversification = args.diversify;
-        solver.use_adaptive_temp = args.adaptive_temp;
-        
         cerr << "#config: seed=" << args.seed 
              << " T0=" << args.T0 
              << " alpha=" << args.alpha
              << " diversify=" << (args.diversify ? "on" : "off")
              << " adaptive_temp=" << (args.adaptive_temp ? "on" : "off") 
              << " verbose=" << (args.verbose ? "on" : "off") << "\n";
-             
-        solver.verbose = args.verbose;
-             
-        solver.run(args.tmax, args.T0, args.alpha, args.iters_per_T);
 
-        if (args.do_check) {
-            bool indep = is_independent(G, solver.best_inS);
-            bool maxm  = is_maximal(G, solver.best_inS);
+        P.start();
+        RunResult<vector<char>> R;
+        if (args.split) {
+            R = P.split(G.n, G.adj, sa_large_solver(args));
+        } else {
+            // Ids y contadores de 16 bits si el grafo lo permite (index_width.hpp)
+            R = P.with_width<GraphT>(G, [&](const auto& Gw) {
+                MIS_SA_T<decay_t<decltype(Gw)>> solver(Gw, args.seed);
+                solver.use_diversification = args.diversify;
+                solver.use_adaptive_temp = args.adaptive_temp;
+                solver.stop_at = P.stop_at;
+                solver.target = args.target;
+                solver.verbose = args.verbose;
+                solver.print_lines = false;
+                solver.init_sol = move(P.warm);
+                solver.stop_flag = P.stop_flag();
+                solver.on_improve = [&](int v, double t) { P.improve(v, t, solver.best_inS, solver.total_moves); };
+                // El punto de partida (greedy o --init_sol / --best_known) solo
+                // va a la curva any-time: stdout sigue sin la línea inicial
+                solver.on_start = [&](int v) { P.improve_start(v, solver.best_inS); };
+                solver.run(args.tmax, args.T0, args.alpha, args.iters_per_T);
+                RunResult<vector<char>> r;
+                r.best = solver.best_size;
+                r.time = solver.best_time;
+                r.reached = solver.reached;
+                r.sol = move(solver.best_inS);
+                return r;
+            });
+        }
+
+        // --check: sobre la solución y el grafo en ids originales
+        function<bool(const vector<char>&)> check;
+        if (args.do_check) check = [&](const vector<char>& best) {
+            restore_graph(G.adj, P.RL);
+            bool indep = is_independent(G, best);
+            bool maxm  = is_maximal(G, best);
             if (!indep || !maxm) {
                 cerr << "[CHECK] ERROR: best_inS "
                      << (indep ? "" : "NO es independiente ")
                      << (maxm  ? "" : "NO es maximal ")
                      << "\n";
-                return 2;
-            } else {
-                cerr << "[CHECK] OK: solución es independiente y maximal\n";
+                return false;
             }
-        }
-        return 0;
+            cerr << "[CHECK] OK: solución es independiente y maximal\n";
+            return true;
+        };
+        return P.finish(R, check);
     } catch (const std::exception& e) {
         cerr << "ERROR: " << e.what() << "\n";
         return 1;
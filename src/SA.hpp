@@ -0,0 +1,606 @@
+// ============================================================================
+// SA.hpp — motor de Simulated Annealing para MIS (namespace sa)
+// -----------------------------------------------------------------------------
+// Grafo, lector, temporizador, MIS_SA y validadores. Lo usan build/SA (SA.cpp)
+// y los binarios que corren el SA dentro del proceso (p.ej. MIS-portfolio).
+// ============================================================================
+#pragma once
+#include <bits/stdc++.h>
+#include "telemetry.hpp"
+#include "vertex_state.hpp"
+#include "graph_load.hpp"
+
+namespace sa {
+using namespace std;
+
+// ----------------------------
+// Estructura de grafo optimizada
+// V: tipo de id de vértice en adj; C: tipo de los contadores conf del SA
+// (ver index_width.hpp). Graph = ints, como siempre.
+// ----------------------------
+template <class V = int, class C = int>
+struct GraphT {
+    using vertex_t = V;
+    using count_t = C;
+    int n = 0;
+    vector<vector<V>> adj;
+    vector<int> degree;  // Precalculamos grados para optimización
+    
+    void compute_degrees() {
+        degree.resize(n);
+        for (int v = 0; v < n; ++v) {
+            degree[v] = (int)adj[v].size();
+        }
+    }
+};
+using Graph = GraphT<>;
+
+// -----------------------------------------------------------------------------
+// read_graph(path, mem_limit)
+// Lee un grafo no dirigido desde archivo. Soporta:
+//   - Línea cabecera "p edge n m" (DIMACS-like)
+//   - Pares "u v" uno por línea (0-based o 1-based)
+// El detector one_based convierte a 0-based si corresponde. Elimina duplicados.
+// Dos pasadas (contar y llenar) sin copia cruda de aristas; ids hasta INT_MAX
+// (graph_load.hpp). Lanza std::runtime_error si no puede abrirse el archivo,
+// si no hay datos o si el grafo supera mem_limit (bytes, 0 = sin límite).
+// -----------------------------------------------------------------------------
+inline Graph read_graph(const string& path, size_t mem_limit = 0) {
+    Graph G;
+    if (!load_adjacency(path, GraphDialect::SA, G.n, G.adj, nullptr, mem_limit)) {
+        if (!ifstream(path)) throw runtime_error("Cannot open file: " + path);
+        throw runtime_error("Graph seems empty or unrecognized format.");
+    }
+    return G;
+}
+
+// ----------------------------
+// Temporizador mejorado con estadísticas
+// ----------------------------
+struct Timer {
+    chrono::steady_clock::time_point t0;
+    Timer() { reset(); }
+    void reset() { t0 = chrono::steady_clock::now(); }
+    double elapsed() const {
+        auto now = chrono::steady_clock::now();
+        chrono::duration<double> diff = now - t0;
+        return diff.count();
+    }
+};
+
+// ============================================================================
+// MIS_SA_OPTIMIZED: versión mejorada del Recocido Simulado para MIS
+// ----------------------------------------------------------------------------
+template <class Gr>
+struct MIS_SA_T {
+    const Gr& G;
+    PackedVertexState<typename Gr::count_t> vs;  // v ∈ S y conflictos (vecinos en S), una palabra por v
+    int curr_size = 0;
+
+    int best_size = 0;
+    vector<char> best_inS;
+    double best_time = 0.0;
+
+    // Nuevas estructuras para optimización
+    vector<int> candidates;     // Lista de candidatos para movimientos
+    vector<char> is_candidate;  // Marcador rápido de candidatos
+    vector<int> vertex_priority; // Prioridad de vértices para diversificación
+    
+    // Estadísticas de rendimiento
+    long long total_moves = 0;
+    long long accepted_moves = 0;
+    long long improvements = 0;
+    int stagnation_count = 0;
+    double last_improvement_time = 0.0;
+    
+    // Parámetros adaptativos
+    bool use_diversification = false;
+    bool use_adaptive_temp = false;
+    bool verbose = false;  // Nuevo: para logging detallado
+    double acceptance_rate = 0.0;
+
+    // Término anticipado: best_size >= stop_at (cota superior o --target)
+    int  stop_at = INT_MAX;
+    int  target = -1;          // --target K (-1: sin objetivo)
+    bool reached = false;
+
+    // Integración con otros motores en el mismo proceso (MIS-portfolio)
+    bool quiet = false;                             // sin salida por stdout/stderr
+    bool print_lines = true;                        // "<best> <time>" por mejora y al final
+    const atomic<bool>* stop_flag = nullptr;        // parada externa
+    function<void(int, double)> on_improve;         // tras cada mejora (best_inS al día)
+    function<void(int)> on_start;                   // punto de partida, t = 0 (best_inS al día)
+    function<bool(int, vector<char>&)> fetch_incumbent; // (best_size, sol): true si hay uno mejor
+    long long reheats = 0;
+    vector<char> init_sol;   // --init_sol / --best_known: arranque en lugar del greedy
+    
+    vector<char> in_queue;  // marcas de complete_to_maximal_local
+
+    mt19937_64 rng;
+    uniform_real_distribution<double> U01;
+    uniform_int_distribution<int> Uv;
+
+    MIS_SA_T(const Gr& G_, uint64_t seed) : G(G_), U01(0.0,1.0) { reset(seed); }
+
+    // Estado de corrida a cero para G (que pudo cambiar si Gr es una vista,
+    // libmis) y la semilla dada. assign conserva la capacidad: reusar el
+    // mismo objeto entre corridas no vuelve a reservar. La configuración
+    // (stop_at, ganchos, init_sol, ...) queda como está.
+    void reset(uint64_t seed) {
+        vs.assign(G.n);
+        in_queue.assign(G.n, 0);
+        best_inS.assign(G.n, 0);
+        is_candidate.assign(G.n, 0);
+        // Pre-reservar memoria para estructuras dinámicas
+        candidates.clear();
+        candidates.reserve(G.n);
+
+        // Inicializar prioridades de vértices (para diversificación)
+        vertex_priority.resize(G.n);
+        for (int v = 0; v < G.n; ++v) {
+            vertex_priority[v] = G.degree[v];
+        }
+
+        curr_size = best_size = 0;
+        best_time = last_improvement_time = acceptance_rate = 0.0;
+        total_moves = accepted_moves = improvements = reheats = 0;
+        stagnation_count = 0;
+        reached = false;
+        rng.seed(seed);
+        U01.reset();
+        Uv = uniform_int_distribution<int>(0, max(0, G.n-1));
+    }
+
+    bool in(int v) const { return vs.in(v); }
+
+    // Agrega v a S y actualiza conflictos
+    void add_vertex(int v) {
+        ++curr_size;
+        vs.add(v, G.adj[v]);
+    }
+    // Quita v de S y actualiza conflictos
+    void remove_vertex(int v) {
+        --curr_size;
+        vs.remove(v, G.adj[v]);
+    }
+
+    // Actualizar lista de candidatos de manera eficiente
+    void update_candidates() {
+        candidates.clear();
+        // Reservar espacio conservadoramente 
+        int estimated_candidates = max(1, G.n - curr_size);
+        candidates.reserve(estimated_candidates);
+        
+        for (int v = 0; v < G.n; ++v) {
+            if (!vs.in(v)) {
+                candidates.push_back(v);
+                is_candidate[v] = 1;
+            } else {
+                is_candidate[v] = 0;
+            }
+        }
+        
+        // Mezclar candidatos para evitar sesgos
+        shuffle(candidates.begin(), candidates.end(), rng);
+    }
+
+    // Inicialización greedy mejorada con múltiples criterios
+    void init_greedy_maximal_improved() {
+        int n = G.n;
+        vector<int> order(n);
+        iota(order.begin(), order.end(), 0);
+        
+        // Ordenar por múltiples criterios: grado, luego por ID para desempate
+        sort(order.begin(), order.end(), [&](int a, int b) {
+            if (G.degree[a] != G.degree[b]) 
+                return G.degree[a] < G.degree[b];
+            return a < b; // Desempate determinístico
+        });
+
+        // Aplicar greedy con mejora local
+        for (int v : order) {
+            if (vs.is_free(v)) {
+                add_vertex(v);
+                
+                // Micro-optimización: intentar agregar vecinos de bajo grado
+                vector<int> low_degree_neighbors;
+                for (int u : G.adj[v]) {
+                    if (vs.is_free(u) && G.degree[u] <= 3) {
+                        low_degree_neighbors.push_back(u);
+                    }
+                }
+                
+                for (int u : low_degree_neighbors) {
+                    if (vs.is_free(u)) {
+                        add_vertex(u);
+                    }
+                }
+            }
+        }
+        
+        update_candidates();
+        best_size = curr_size;
+        vs.export_membership(best_inS);
+        best_time = 0.0;
+    }
+
+    // Arranque desde una solución previa (reparada y completada a maximal)
+    void init_from_solution(const vector<char>& sol) {
+        load_solution(sol);
+        best_size = curr_size;
+        vs.export_membership(best_inS);
+        best_time = 0.0;
+    }
+
+    // Completar a maximal (añade cualquier v libre: fuera de S y conf 0)
+    void complete_to_maximal() {
+        bool added = true;
+        while (added) {
+            added = false;
+            for (int v=0; v<G.n; ++v) {
+                if (vs.is_free(v)) {
+                    add_vertex(v);
+                    added = true;
+                }
+            }
+        }
+    }
+
+    // Versión local: completa a maximal solo en la región afectada
+    void complete_to_maximal_local(const std::vector<int>& frontier_in) {
+        std::deque<int> q;
+        q.insert(q.end(), frontier_in.begin(), frontier_in.end());
+        // Todo lo marcado pasa por la cola y se desmarca al salir: inQueue
+        // queda en cero entre llamadas (sin reservar n bytes por movimiento)
+        std::vector<char>& inQueue = in_queue;
+        for (int x : frontier_in)
+            if (0 <= x && x < G.n)
+                inQueue[x] = 1;
+
+        while (!q.empty()) {
+            int x = q.front();
+            q.pop_front();
+            inQueue[x] = 0;
+
+            // Si x no está en S y no tiene vecinos en S, se puede agregar
+            if (vs.is_free(x)) {
+                add_vertex(x);
+                // Al añadir x, sus vecinos podrían volverse candidatos
+                for (int w : G.adj[x]) {
+                    if (!inQueue[w]) {
+                        q.push_back(w);
+                        inQueue[w] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    // Movimiento aceptado: v entra a S, salen sus vecinos en S y se completa
+    // a maximal en la región afectada
+    void apply_move(int v) {
+        // Actualizar prioridad del vértice seleccionado
+        vertex_priority[v]++;
+        
+        vector<int> removed;
+        for (int u : G.adj[v]) {
+            if (vs.in(u)) {
+                remove_vertex(u);
+                removed.push_back(u);
+                // Decrementar prioridad de vértices removidos
+                vertex_priority[u] = max(0, vertex_priority[u] - 1);
+            }
+        }
+
+        add_vertex(v);
+
+        // Construcción de frontera optimizada con estimación más precisa
+        int frontier_capacity = 1 + removed.size();
+        for (int u : removed) {
+            frontier_capacity += min(G.degree[u], G.n); // Limitar para evitar overflow
+        }
+        frontier_capacity += min(G.degree[v], G.n);
+        frontier_capacity = min(frontier_capacity, G.n * 2); // Limitar máximo
+        
+        vector<int> frontier;
+        frontier.reserve(frontier_capacity);
+        
+        frontier.push_back(v);
+        frontier.insert(frontier.end(), removed.begin(), removed.end());
+        for (int u : removed) {
+            frontier.insert(frontier.end(), G.adj[u].begin(), G.adj[u].end());
+        }
+        frontier.insert(frontier.end(), G.adj[v].begin(), G.adj[v].end());
+
+        complete_to_maximal_local(frontier);
+    }
+
+    // Registra mejor solución con estadísticas mejoradas
+    void maybe_record_best(double elapsed_sec) {
+        if (curr_size > best_size) {
+            best_size = curr_size;
+            vs.export_membership(best_inS);
+            best_time = elapsed_sec;
+            last_improvement_time = elapsed_sec;
+            improvements++;
+            stagnation_count = 0;
+            if (best_size >= stop_at) reached = true;
+            if (on_improve) on_improve(best_size, best_time);
+            if (quiet || !print_lines) return;
+            
+            cout.setf(std::ios::fixed);
+            cout << setprecision(6) << best_size << " " << best_time << "\n";
+            cout.flush();
+        }
+    }
+
+    // Reemplaza la solución actual por sol (se asume independiente; si no lo
+    // es, se descartan los vértices en conflicto) y la completa a maximal
+    void load_solution(const vector<char>& sol) {
+        vs.clear();
+        curr_size = 0;
+        for (int v = 0; v < G.n; ++v)
+            if (sol[v] && vs.is_free(v)) add_vertex(v);
+        complete_to_maximal();
+        update_candidates();
+    }
+
+    inline bool stopped() const {
+        return reached || (stop_flag && stop_flag->load(memory_order_relaxed));
+    }
+
+    // Estrategia de diversificación cuando hay estancamiento
+    void diversify_solution() {
+        if (!use_diversification) return;
+        TEL_COUNT("sa.diversify", 1);
+        
+        int original_size = curr_size;
+        
+        // Crear lista de vértices en S ordenados por prioridad
+        vector<pair<int, int>> vertices_with_priority;
+        vertices_with_priority.reserve(curr_size);
+        
+        for (int v = 0; v < G.n; ++v) {
+            if (vs.in(v)) {
+                vertices_with_priority.emplace_back(vertex_priority[v], v);
+            }
+        }
+        
+        // Ordenar por prioridad (más alta primero)
+        sort(vertices_with_priority.begin(), vertices_with_priority.end(), 
+             greater<pair<int, int>>());
+        
+        // Remover hasta 20% de los vértices con mayor prioridad
+        int to_remove = min((int)vertices_with_priority.size(), 
+                           max(1, curr_size / 5));
+        
+        for (int i = 0; i < to_remove; ++i) {
+            int v = vertices_with_priority[i].second;
+            remove_vertex(v);
+        }
+        
+        // Completar a maximal
+        complete_to_maximal();
+        update_candidates();
+        
+        if (verbose) {
+            cerr << "#diversify: removed=" << to_remove 
+                 << " size " << original_size << "->" << curr_size << "\n";
+        }
+        
+        // Reiniciar prioridades gradualmente (no completamente)
+        for (int v = 0; v < G.n; ++v) {
+            vertex_priority[v] = (vertex_priority[v] + G.degree[v]) / 2;
+        }
+    }
+
+    // Control de temperatura adaptativo
+    double adaptive_temperature_update(double T, double target_acceptance = 0.4) {
+        if (!use_adaptive_temp) return T * 0.9995; // Comportamiento original
+        
+        const double tolerance = 0.05;
+        const double fast_cooling = 0.985;
+        const double normal_cooling = 0.9995;
+        const double slow_cooling = 0.9999;
+        
+        if (acceptance_rate > target_acceptance + tolerance) {
+            // Demasiadas aceptaciones -> enfriar más rápido
+            return T * fast_cooling;
+        } else if (acceptance_rate < target_acceptance - tolerance) {
+            // Muy pocas aceptaciones -> enfriar más lento
+            return T * slow_cooling;
+        } else {
+            // En el rango objetivo -> enfriamiento normal
+            return T * normal_cooling;
+        }
+    }
+
+    // Bucle principal optimizado con mejoras adaptativas
+    void run(double tmax, double T0, double alpha, int iters_per_T) {
+        Timer tim;
+        TEL_PHASE("init");
+        if (init_sol.empty()) init_greedy_maximal_improved();  // Inicialización mejorada
+        else init_from_solution(init_sol);
+        
+        // Ajuste dinámico más inteligente
+        if (iters_per_T <= 0 || iters_per_T == 1000) {
+            iters_per_T = max(1000, min(10000, G.n * 3));
+        }
+        // update_candidates() recorre y baraja los n vértices: cada 100
+        // iteraciones hasta n = 10^5; más allá, cada n/1000 para que su costo
+        // por movimiento no crezca con n
+        const int refresh_every = max(100, G.n / 1000);
+
+        maybe_record_best(0.0);
+        if (best_size >= stop_at) reached = true;  // el greedy ya es óptimo
+        // La inicialización ya dejó el punto de partida (greedy o init_sol)
+        // como mejor, así que maybe_record_best no lo ve como mejora
+        if (on_start) on_start(best_size);
+
+        double T = T0;
+        if (G.n == 0) return;
+
+        long long moves_in_block = 0;
+        long long accepted_in_block = 0;
+
+        vector<char> incumbent;
+        TEL_PHASE("main_loop");
+
+        while (!stopped()) {
+            double el = tim.elapsed();
+            if (el >= tmax) break;
+
+            // Verificar estancamiento para diversificación
+            if (use_diversification && el - last_improvement_time > tmax * 0.1) {
+                stagnation_count++;
+                if (stagnation_count >= 3) {
+                    diversify_solution();
+                    maybe_record_best(tim.elapsed());
+                    stagnation_count = 0;
+                    last_improvement_time = el;
+                }
+            }
+
+            moves_in_block = 0;
+            accepted_in_block = 0;
+
+            // Bloque de iteraciones por temperatura
+            for (int it = 0; it < iters_per_T; ++it) {
+                // El flag (vigía de deadline.hpp, señales, portafolio) se lee en
+                // cada movimiento; el reloj, cada 512 como respaldo
+                if (stopped()) break;
+                if ((it & 511) == 0) {
+                    el = tim.elapsed();
+                    if (el >= tmax) break;
+                }
+
+                // Selección de vértice optimizada
+                if (candidates.empty()) update_candidates();
+                
+                int v = -1;
+                if (!candidates.empty() && U01(rng) < 0.8) {
+                    // 80% del tiempo: usar candidatos precalculados
+                    int idx = uniform_int_distribution<int>(0, (int)candidates.size()-1)(rng);
+                    v = candidates[idx];
+                    
+                    // Optimización: remover candidato usado para evitar repetición inmediata
+                    if (candidates.size() > 10) { // Solo si hay suficientes candidatos
+                        swap(candidates[idx], candidates.back());
+                        candidates.pop_back();
+                    }
+                    // La lista puede estar desfasada: v pudo entrar a S después
+                    // del último update_candidates(); re-agregarlo inflaría curr_size
+                    if (vs.in(v)) continue;
+                } else {
+                    // 20% del tiempo: selección completamente aleatoria
+                    for (int tries = 0; tries < 16; ++tries) {
+                        v = Uv(rng);
+                        if (!vs.in(v)) break;
+                    }
+                    if (vs.in(v)) continue;
+                }
+
+                int k = vs.conf(v);
+                int delta = 1 - k;
+                bool accept = (delta >= 0);
+                
+                moves_in_block++;
+                total_moves++;
+
+                if (!accept && T > 1e-9) {
+                    double prob = exp(delta / T);
+                    accept = (U01(rng) < prob);
+                }
+
+                if (accept) {
+                    accepted_in_block++;
+                    accepted_moves++;
+                    
+                    apply_move(v);
+                    maybe_record_best(tim.elapsed());
+                    if (reached) break;
+                    
+                    // Actualizar candidatos si es necesario
+                    if (it % refresh_every == 0) update_candidates();
+                }
+            }
+
+            // Calcular tasa de aceptación para control adaptativo
+            if (moves_in_block > 0) {
+                acceptance_rate = 0.9 * acceptance_rate + 
+                                0.1 * (double(accepted_in_block) / moves_in_block);
+            }
+
+            // Actualización de temperatura (adaptativa o fija)
+            if (use_adaptive_temp) {
+                T = adaptive_temperature_update(T);
+            } else {
+                T *= alpha;
+            }
+            
+            if (T < 1e-12) T = 1e-12;
+
+            // Recalentamiento desde un incumbente externo mejor
+            if (fetch_incumbent && fetch_incumbent(best_size, incumbent)) {
+                load_solution(incumbent);
+                maybe_record_best(tim.elapsed());
+                T = T0;
+                reheats++;
+            }
+        }
+
+        // Contadores acumulados al final: el bucle de movimientos no paga nada
+        TEL_COUNT("sa.moves", total_moves);
+        TEL_COUNT("sa.accepted", accepted_moves);
+        TEL_COUNT("sa.improvements", improvements);
+        TEL_COUNT("sa.reheats", reheats);
+
+        if (quiet) return;
+
+        // Estadísticas finales (enviadas a stderr para no interferir con salida)
+        if (total_moves > 0) {
+            double final_acceptance_rate = double(accepted_moves) / total_moves;
+            double avg_moves_per_second = total_moves / tim.elapsed();
+            
+            cerr << "#stats: total_moves=" << total_moves 
+                 << " accepted=" << accepted_moves 
+                 << " rate=" << fixed << setprecision(3) << final_acceptance_rate
+                 << " improvements=" << improvements 
+                 << " moves_per_sec=" << fixed << setprecision(0) << avg_moves_per_second
+                 << "\n";
+        }
+
+        // Repetir mejor línea al final (con gap si hay --target)
+        if (!print_lines) return;
+        cout.setf(std::ios::fixed);
+        cout << setprecision(6) << best_size << " " << best_time;
+        if (target > 0) cout << " " << (target - best_size);
+        cout << "\n";
+        cout.flush();
+    }
+};
+using MIS_SA = MIS_SA_T<Graph>;
+
+// -----------------------------------------------------------------------------
+// Validadores de la mejor solución (opcionales, activados con --check)
+//   - is_independent: no hay aristas internas en S
+//   - is_maximal    : no se puede agregar ningún vértice sin romper independencia
+// -----------------------------------------------------------------------------
+template <class Gr>
+inline bool is_independent(const Gr& G, const vector<char>& inS) {
+    for (int u = 0; u < G.n; ++u) if (inS[u]) {
+        for (int v : G.adj[u]) if (inS[v]) return false;
+    }
+    return true;
+}
+template <class Gr>
+inline bool is_maximal(const Gr& G, const vector<char>& inS) {
+    for (int u = 0; u < G.n; ++u) if (!inS[u]) {
+        bool ok = true;
+        for (int v : G.adj[u]) if (inS[v]) { ok = false; break; }
+        if (ok) return false; // se podría agregar u ⇒ no es maximal
+    }
+    return true;
+}
+
+} // namespace sa
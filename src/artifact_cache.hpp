@@ -0,0 +1,249 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "bounds.hpp"
+#include "components.hpp"
+#include "reorder.hpp"
+#include "utils.hpp"
+
+/**
+ * Caché en disco de artefactos de preprocesamiento por instancia (--cache DIR
+ * en SA, GA y solver_MISP).
+ *
+ * Cada corrida sobre la misma instancia recalculaba lo mismo antes de buscar:
+ *
+ *  - order.<modo>:  el orden de --reorder (BFS / Cuthill-McKee / grado);
+ *  - ub.<modo>:     las cotas de bounds.hpp sobre el grafo reetiquetado;
+ *  - exact.<modo>:  con --split, la solución óptima de las componentes
+ *                   pequeñas que el B&B cerró (por vértice: -1 o 0/1).
+ *
+ * Un artefacto es DIR/<clave>.<nombre>: cabecera fija + arreglo de int32. La
+ * clave es graph_content_hash (solution_io.hpp) del grafo cargado, antes de
+ * reetiquetar, así que otro archivo con el mismo grafo la comparte. La
+ * cabecera lleva magia, versión del formato, versión del algoritmo que lo
+ * produjo, clave, n y largo: si algo no cuadra (grafo cambiado, algoritmo
+ * nuevo, archivo truncado) se ignora y se recalcula encima. Al cambiar uno de
+ * los algoritmos hay que subir su versión (kOrderVersion, ...).
+ *
+ * Al reusar, el archivo se mapea (mmap, solo lectura) y se usa en el lugar:
+ * el arranque pasa a costar el hash del grafo y un page-in. Se escribe con
+ * temporal + rename, así que dos corridas a la vez nunca ven uno a medias.
+ * stderr: "#cache: key=.. hits=.. misses=.. time=..".
+ */
+
+constexpr uint32_t kArtifactFormat = 1;
+constexpr uint32_t kOrderVersion = 1;    // vertex_order (reorder.hpp)
+constexpr uint32_t kBoundsVersion = 1;   // compute_upper_bounds (bounds.hpp)
+constexpr uint32_t kExactVersion = 1;    // B&B de componentes (components.hpp)
+
+struct ArtifactHeader {
+    char magic[8];       // "MISCACHE"
+    uint32_t format;
+    uint32_t version;
+    uint64_t key;
+    int64_t n;
+    uint64_t count;      // int32 que siguen a la cabecera
+};
+
+// Artefacto mapeado en memoria; vacío si no había uno válido
+class MappedArtifact {
+public:
+    MappedArtifact() = default;
+    MappedArtifact(void* base, size_t bytes) : base_(base), bytes_(bytes) {}
+    MappedArtifact(MappedArtifact&& o) noexcept { swap(o); }
+    MappedArtifact& operator=(MappedArtifact&& o) noexcept { swap(o); return *this; }
+    MappedArtifact(const MappedArtifact&) = delete;
+    MappedArtifact& operator=(const MappedArtifact&) = delete;
+    ~MappedArtifact() { if (base_) munmap(base_, bytes_); }
+
+    explicit operator bool() const { return base_ != nullptr; }
+    const int32_t* data() const {
+        return base_ ? (const int32_t*)((const char*)base_ + sizeof(ArtifactHeader)) : nullptr;
+    }
+    size_t size() const { return base_ ? ((const ArtifactHeader*)base_)->count : 0; }
+
+private:
+    void* base_ = nullptr;
+    size_t bytes_ = 0;
+    void swap(MappedArtifact& o) { std::swap(base_, o.base_); std::swap(bytes_, o.bytes_); }
+};
+
+class ArtifactCache {
+public:
+    ArtifactCache() = default;
+    // dir vacío: desactivado; key = graph_content_hash del grafo cargado
+    ArtifactCache(const std::string& dir, int n, uint64_t key) : dir_(dir), n_(n), key_(key) {
+        if (dir_.empty()) return;
+        if (mkdir(dir_.c_str(), 0755) != 0 && errno != EEXIST)
+            throw std::runtime_error("--cache: no se pudo crear " + dir_ + ": " + std::strerror(errno));
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)key_);
+        hex_ = hex;
+    }
+
+    bool enabled() const { return !dir_.empty(); }
+    std::string path(const std::string& name) const { return dir_ + "/" + hex_ + "." + name; }
+
+    // Artefacto válido para esta clave, n y versión (si no, vacío)
+    MappedArtifact get(const std::string& name, uint32_t version) {
+        if (!enabled()) return MappedArtifact();
+        const int fd = ::open(path(name).c_str(), O_RDONLY);
+        if (fd < 0) { ++misses_; return MappedArtifact(); }
+        struct stat st;
+        void* base = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(ArtifactHeader))
+            base = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) { ++misses_; return MappedArtifact(); }
+        MappedArtifact a(base, (size_t)st.st_size);
+        const ArtifactHeader* h = (const ArtifactHeader*)base;
+        if (std::memcmp(h->magic, "MISCACHE", 8) != 0 || h->format != kArtifactFormat ||
+            h->version != version || h->key != key_ || h->n != n_ ||
+            (size_t)st.st_size != sizeof(ArtifactHeader) + h->count * sizeof(int32_t)) {
+            ++misses_;
+            return MappedArtifact();
+        }
+        ++hits_;
+        return a;
+    }
+
+    // Guarda (o reemplaza) el artefacto; un error de escritura solo se pierde
+    // el caché, la corrida sigue
+    bool put(const std::string& name, uint32_t version, const int32_t* data, size_t count) {
+        if (!enabled()) return false;
+        ArtifactHeader h{};
+        std::memcpy(h.magic, "MISCACHE", 8);
+        h.format = kArtifactFormat;
+        h.version = version;
+        h.key = key_;
+        h.n = n_;
+        h.count = count;
+        const std::string dst = path(name), tmp = dst + ".tmp." + std::to_string(getpid());
+        const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        bool ok = write_all(fd, &h, sizeof(h)) && write_all(fd, data, count * sizeof(int32_t));
+        ok = ::close(fd) == 0 && ok;
+        if (!ok || std::rename(tmp.c_str(), dst.c_str()) != 0) {
+            std::remove(tmp.c_str());
+            return false;
+        }
+        ++stores_;
+        return true;
+    }
+
+    void add_time(double s) { seconds_ += s; }
+    void report() const {
+        if (!enabled()) return;
+        std::cerr << "#cache: key=" << hex_ << " hits=" << hits_ << " misses=" << misses_
+                  << " stored=" << stores_ << " time=" << std::fixed << std::setprecision(4) << seconds_
+                  << std::defaultfloat << std::setprecision(6) << "\n";
+    }
+
+private:
+    std::string dir_, hex_;
+    int n_ = 0;
+    uint64_t key_ = 0;
+    int hits_ = 0, misses_ = 0, stores_ = 0;
+    double seconds_ = 0.0;
+
+    static bool write_all(int fd, const void* p, size_t bytes) {
+        const char* c = (const char*)p;
+        while (bytes > 0) {
+            const ssize_t w = ::write(fd, c, bytes);
+            if (w <= 0) return false;
+            c += w;
+            bytes -= (size_t)w;
+        }
+        return true;
+    }
+};
+
+// reorder_graph con el orden guardado si lo hay (rep->seconds incluye buscarlo)
+inline Relabeling cached_reorder_graph(ArtifactCache& cache, int n, std::vector<std::vector<int>>& adj,
+                                       ReorderMode mode, ReorderReport* rep = nullptr) {
+    if (!cache.enabled() || mode == ReorderMode::None) return reorder_graph(n, adj, mode, rep);
+    const double t0 = now_seconds();
+    const std::string name = std::string("order.") + reorder_name(mode);
+    std::vector<int> order;
+    if (MappedArtifact a = cache.get(name, kOrderVersion)) {
+        // Solo se acepta una permutación de 0..n-1
+        if (a.size() == (size_t)n) {
+            std::vector<char> seen(n, 0);
+            bool ok = true;
+            for (int k = 0; k < n && ok; ++k) {
+                const int v = a.data()[k];
+                ok = v >= 0 && v < n && !seen[v];
+                if (ok) seen[v] = 1;
+            }
+            if (ok) order.assign(a.data(), a.data() + n);
+        }
+    }
+    if (order.empty()) {
+        order = vertex_order(n, adj, mode);
+        cache.put(name, kOrderVersion, order.data(), order.size());
+    }
+    const double t_order = now_seconds() - t0;
+    cache.add_time(t_order);
+    Relabeling R = reorder_graph(n, adj, std::move(order), rep);
+    if (rep) rep->seconds += t_order;
+    return R;
+}
+
+// compute_upper_bounds sobre el grafo ya reetiquetado con mode
+inline UpperBounds cached_upper_bounds(ArtifactCache& cache, ReorderMode mode, int n,
+                                       const std::vector<std::vector<int>>& adj) {
+    if (!cache.enabled()) return compute_upper_bounds(n, adj);
+    const double t0 = now_seconds();
+    const std::string name = std::string("ub.") + reorder_name(mode);
+    UpperBounds B;
+    if (MappedArtifact a = cache.get(name, kBoundsVersion); a && a.size() == 3) {
+        B.clique_cover = a.data()[0];
+        B.matching = a.data()[1];
+        B.edges = a.data()[2];
+    } else {
+        B = compute_upper_bounds(n, adj);
+        const int32_t v[3] = {B.clique_cover, B.matching, B.edges};
+        cache.put(name, kBoundsVersion, v, 3);
+    }
+    cache.add_time(now_seconds() - t0);
+    return B;
+}
+
+/**
+ * --split: soluciones exactas de componentes pequeñas de corridas anteriores.
+ * attach() pasa lo guardado a solve_by_components (SplitOptions::exact_known)
+ * y le pide lo que cierre ahora; save() guarda si hubo componentes nuevas.
+ */
+struct ExactMemo {
+    MappedArtifact known;
+    std::vector<int32_t> found;
+
+    void attach(ArtifactCache& cache, ReorderMode mode, int n, SplitOptions& so) {
+        if (!cache.enabled()) return;
+        known = cache.get(std::string("exact.") + reorder_name(mode), kExactVersion);
+        if (known && known.size() != (size_t)n) known = MappedArtifact();
+        so.exact_known = known.data();
+        so.exact_found = &found;
+    }
+    void save(ArtifactCache& cache, ReorderMode mode) const {
+        if (!cache.enabled() || found.empty()) return;
+        const size_t before = known ? (size_t)std::count_if(known.data(), known.data() + known.size(),
+                                                             [](int32_t x) { return x >= 0; })
+                                    : 0;
+        const size_t after = (size_t)std::count_if(found.begin(), found.end(), [](int32_t x) { return x >= 0; });
+        if (after > before)
+            cache.put(std::string("exact.") + reorder_name(mode), kExactVersion, found.data(), found.size());
+    }
+};
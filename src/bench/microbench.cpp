@@ -0,0 +1,469 @@
+// microbench.cpp
+// Micro-benchmarks de los kernels calientes de SA, GA y GA+LS (make bench).
+//
+// Uso (CLI):
+//   ./build/mis-microbench [--out resultados.json] [--sizes 1000,3000,10000]
+//                          [--ps 0.05,0.5,0.9] [--kernels sub1,sub2]
+//                          [--min_time 0.02] [--samples 10] [--seed s] [--perf]
+//                          [--load_threads 2,4,8]
+//
+// - Grafos G(n,p) generados con gen/gnp.hpp (misma semilla => mismo grafo).
+// - Cada kernel se mide en --samples muestras; cada muestra repite la
+//   operación hasta durar --min_time segundos. Los kernels con preparación
+//   (setup) se cronometran operación por operación, sin contar el setup.
+// - --kernels filtra por subcadena del nombre (p.ej. "ga.,load").
+// - stdout: tabla legible; --out: JSON con ns/op (media, desvío, varianza,
+//   mínimo, mediana) por (kernel, n, p). Comparar dos corridas con
+//   scripts/bench_compare.py.
+// - --perf: además, fallos de L1D y LLC por operación (perf_counters.hpp),
+//   medidos en una pasada extra fuera de las muestras de tiempo. Sin PMU
+//   (VM, contenedor) se avisa por stderr y las columnas quedan en "-".
+// - width.*.w32 / width.*.w16: el mismo kernel con ids y contadores int o
+//   uint16_t (index_width.hpp); p=0.9 muestra el ahorro de ancho de banda.
+// - load.*: lectores de .graph sobre un archivo temporal, en secuencial
+//   (load.graph_io, load.csr, ...) y con T hilos (load.*.tT, un kernel por T
+//   de --load_threads; por defecto, los núcleos). Además de ns/op reportan
+//   GB/s del archivo ("gb_per_s" en el JSON).
+
+#include <bits/stdc++.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../graph_io.hpp"
+#include "../SA.hpp"
+#include "../ga/GA.hpp"
+#include "../final/solver_MISP.hpp"
+#include "../gen/gnp.hpp"
+#include "../csr.hpp"
+#include "../index_width.hpp"
+#include "../perf_counters.hpp"
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+struct Options {
+    vector<int> sizes = {1000, 3000, 10000};
+    vector<double> ps = {0.05, 0.5, 0.9};
+    vector<string> filters;
+    double min_time = 0.02;   // segundos por muestra
+    int samples = 10;
+    double max_kernel_time = 3.0; // tope por kernel (se respetan >= 3 muestras)
+    uint64_t seed = 1;
+    string out;
+    bool perf = false;
+    vector<int> load_threads = {max(2, (int)thread::hardware_concurrency())};
+};
+
+struct Result {
+    string kernel;
+    int n;
+    double p;
+    long long m;
+    vector<double> ns;        // ns/op por muestra
+    long long ops_per_sample;
+    double l1d_per_op = -1;   // --perf (-1: no medido)
+    double llc_per_op = -1;
+    long long bytes = 0;      // load.*: tamaño del archivo leído
+};
+
+// Un kernel: run() es la operación medida; setup() (opcional) la prepara y
+// no entra en el tiempo
+struct Kernel {
+    string name;
+    function<void()> setup;
+    function<void()> run;
+    long long bytes = 0;      // > 0: reportar GB/s
+};
+
+static bool selected(const Options& O, const string& name) {
+    if (O.filters.empty()) return true;
+    for (auto& f : O.filters) if (name.find(f) != string::npos) return true;
+    return false;
+}
+
+static double secs(Clock::time_point a, Clock::time_point b) {
+    return chrono::duration<double>(b - a).count();
+}
+
+// Grupo de contadores del hilo principal (--perf); nulo si no se pidió o no hay PMU
+static PerfThread* g_perf = nullptr;
+
+static void count_misses(Result& R, const PerfSample& d, long long ops) {
+    R.l1d_per_op = (double)d.v[2] / ops;
+    R.llc_per_op = (double)d.v[3] / ops;
+}
+
+static Result measure(const Options& O, const Kernel& K) {
+    Result R;
+    R.kernel = K.name;
+    R.bytes = K.bytes;
+    R.ops_per_sample = 1;
+    const auto t_start = Clock::now();
+
+    if (K.setup) {
+        // Operación por operación: setup fuera del cronómetro
+        for (int s = 0; s < O.samples; ++s) {
+            double acc = 0.0;
+            long long ops = 0;
+            do {
+                K.setup();
+                auto a = Clock::now();
+                K.run();
+                acc += secs(a, Clock::now());
+                ++ops;
+            } while (acc < O.min_time);
+            R.ns.push_back(acc * 1e9 / ops);
+            R.ops_per_sample = ops;
+            if (s >= 2 && secs(t_start, Clock::now()) > O.max_kernel_time) break;
+        }
+        if (g_perf) {
+            PerfSample d;
+            for (long long i = 0; i < R.ops_per_sample; ++i) {
+                K.setup();
+                PerfSample a = g_perf->read_all();
+                K.run();
+                d += g_perf->read_all() - a;
+            }
+            count_misses(R, d, R.ops_per_sample);
+        }
+        return R;
+    }
+
+    // Calibración: duplicar el lote hasta que una muestra dure min_time
+    long long batch = 1;
+    K.run();
+    while (true) {
+        auto a = Clock::now();
+        for (long long i = 0; i < batch; ++i) K.run();
+        double t = secs(a, Clock::now());
+        if (t >= O.min_time || batch >= (1LL << 40)) break;
+        batch = (t <= 0) ? batch * 16 : max(batch * 2, (long long)(batch * O.min_time / t * 1.2));
+    }
+    R.ops_per_sample = batch;
+    for (int s = 0; s < O.samples; ++s) {
+        auto a = Clock::now();
+        for (long long i = 0; i < batch; ++i) K.run();
+        R.ns.push_back(secs(a, Clock::now()) * 1e9 / batch);
+        if (s >= 2 && secs(t_start, Clock::now()) > O.max_kernel_time) break;
+    }
+    if (g_perf) {
+        PerfSample a = g_perf->read_all();
+        for (long long i = 0; i < batch; ++i) K.run();
+        count_misses(R, g_perf->read_all() - a, batch);
+    }
+    return R;
+}
+
+struct Summary { double mean, stddev, var, mn, median; };
+
+static Summary summarize(vector<double> v) {
+    Summary S{};
+    const double k = (double)v.size();
+    S.mean = accumulate(v.begin(), v.end(), 0.0) / k;
+    for (double x : v) S.var += (x - S.mean) * (x - S.mean);
+    S.var = v.size() > 1 ? S.var / (k - 1) : 0.0;
+    S.stddev = sqrt(S.var);
+    sort(v.begin(), v.end());
+    S.mn = v.front();
+    S.median = (v.size() % 2) ? v[v.size() / 2] : 0.5 * (v[v.size() / 2 - 1] + v[v.size() / 2]);
+    return S;
+}
+
+// Evita que el compilador elimine el trabajo de un kernel
+static volatile long long sink;
+
+// --------------------------------------------------------------------------
+// Kernels por grafo
+// --------------------------------------------------------------------------
+
+static void write_graph_file(const string& path, const GenSpec& g) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) throw runtime_error("No se pudo escribir " + path);
+    fprintf(f, "%d\n", g.n);
+    gnp_for_each_edge(g, [&](int v, int w) { fprintf(f, "%d %d\n", w, v); });
+    fclose(f);
+}
+
+static void bench_graph(const Options& O, const GenSpec& gs, vector<Result>& out) {
+    long long m = 0;
+    vector<vector<int>> adj = gnp_adjacency(gs, &m);
+    mt19937_64 pick(O.seed);
+    auto emit = [&](const Kernel& K) {
+        if (!selected(O, K.name)) return;
+        Result R = measure(O, K);
+        R.n = gs.n; R.p = gs.p; R.m = m;
+        Summary S = summarize(R.ns);
+        cout << left << setw(34) << K.name << right << setw(7) << gs.n
+             << setw(6) << defaultfloat << gs.p
+             << setw(16) << fixed << setprecision(1) << S.mean
+             << setw(12) << S.stddev << setw(8) << R.ns.size();
+        if (O.perf) {
+            if (R.l1d_per_op >= 0) cout << setw(10) << setprecision(2) << R.l1d_per_op << setw(10) << R.llc_per_op;
+            else cout << setw(10) << "-" << setw(10) << "-";
+        }
+        if (R.bytes > 0) cout << setw(10) << setprecision(3) << R.bytes / S.mean << " GB/s";
+        cout << "\n" << flush;
+        out.push_back(move(R));
+    };
+
+    // ---- carga desde archivo: los cuatro lectores y el CSR, en secuencial y en paralelo
+    if (selected(O, "load.")) {
+        string path = "/tmp/mis_microbench_" + to_string(getpid()) + ".graph";
+        write_graph_file(path, gs);
+        struct stat st;
+        const long long bytes = stat(path.c_str(), &st) == 0 ? (long long)st.st_size : 0;
+        set_load_threads(1);
+        emit({"load.graph_io", {}, [&] { sink = load_graph(path).m; }, bytes});
+        emit({"load.sa_read_graph", {}, [&] { sink = sa::read_graph(path).n; }, bytes});
+        emit({"load.ga_graph", {}, [&] { ga::Graph g; g.load(path); sink = g.n; }, bytes});
+        emit({"load.gals_graph", {}, [&] { gals::GraphR g; g.load(path); sink = g.n; }, bytes});
+        emit({"load.csr", {}, [&] { sink = load_csr(path).off.back(); }, bytes});
+        for (int T : O.load_threads) {
+            if (T < 2) continue;
+            const string t = ".t" + to_string(T);
+            set_load_threads(T);
+            emit({"load.graph_io" + t, {}, [&] { sink = load_graph(path).m; }, bytes});
+            emit({"load.ga_graph" + t, {}, [&] { ga::Graph g; g.load(path); sink = g.n; }, bytes});
+            emit({"load.csr" + t, {}, [&] { sink = load_csr(path).off.back(); }, bytes});
+        }
+        set_load_threads(0);
+        remove(path.c_str());
+    }
+
+    // ---- SA
+    {
+        sa::Graph G; G.n = gs.n; G.adj = adj; G.compute_degrees();
+        sa::MIS_SA S(G, O.seed);
+        S.quiet = true;
+        S.init_greedy_maximal_improved();
+        uniform_int_distribution<int> U(0, gs.n - 1);
+        emit({"sa.add_remove_vertex", {}, [&] {
+            int v = U(pick);
+            if (S.in(v)) { S.remove_vertex(v); S.add_vertex(v); }
+            else { S.add_vertex(v); S.remove_vertex(v); }
+        }});
+        // Movimiento del SA: entra v, salen sus vecinos en S, completar local
+        emit({"sa.move", {}, [&] {
+            int v = U(pick);
+            for (int t = 0; t < 16 && S.in(v); ++t) v = U(pick);
+            if (!S.in(v)) S.apply_move(v);
+            sink = S.curr_size;
+        }});
+    }
+
+    // ---- GA
+    {
+        ga::Graph G; G.n = gs.n; G.adj = adj;
+        ga::rng.seed((unsigned)O.seed);
+        ga::MISState st = ga::greedy_deterministic(G);
+        uniform_int_distribution<int> U(0, gs.n - 1);
+        emit({"ga.add_remove_vertex", {}, [&] {
+            int v = U(pick);
+            if (st.in(v)) { st.remove_vertex(v); st.add_vertex(v); }
+            else { st.add_vertex(v); st.remove_vertex(v); }
+        }});
+        // Sacar un vértice de S y completar a maximal en su vecindad
+        vector<int> frontier;
+        emit({"ga.complete_to_maximal_local", {}, [&] {
+            int u = U(pick);
+            for (int t = 0; t < 64 && !st.in(u); ++t) u = U(pick);
+            if (!st.in(u)) return;
+            st.remove_vertex(u);
+            frontier.assign(1, u);
+            frontier.insert(frontier.end(), G.adj[u].begin(), G.adj[u].end());
+            st.complete_to_maximal_local(frontier);
+        }});
+
+        vector<ga::Individual> pop = ga::init_population(G, 8, "mix");
+        uniform_int_distribution<int> Up(0, (int)pop.size() - 1);
+        emit({"ga.crossover_union_repair", {}, [&] {
+            sink = ga::crossover_union_repair(G, pop[Up(pick)], pop[Up(pick)]).fit;
+        }});
+        emit({"ga.crossover_intersection_biased", {}, [&] {
+            sink = ga::crossover_intersection_biased(G, pop[Up(pick)], pop[Up(pick)]).fit;
+        }});
+        ga::Individual I;
+        emit({"ga.mutate_soft", [&] { I = pop[Up(pick)]; }, [&] {
+            ga::mutate_soft(G, I, 0.1512);
+        }});
+        // Reparación sobre la unión de dos padres (la unión no se cronometra)
+        ga::MISState rs(&G);
+        emit({"ga.repair_and_complete", [&] {
+            const auto& A = pop[Up(pick)];
+            const auto& B = pop[Up(pick)];
+            rs.reset(&G);
+            for (int v = 0; v < G.n; ++v) if (A.inS[v] || B.inS[v]) rs.add_vertex(v);
+        }, [&] { rs.repair_and_complete(); }});
+    }
+
+    // ---- GA+LS (solver_MISP)
+    {
+        gals::GraphR G; G.n = gs.n; G.adj = adj;
+        gals::RandR R((unsigned)O.seed);
+        vector<gals::MISState> pop;
+        for (int i = 0; i < 8; ++i) {
+            gals::MISState s = gals::greedy_init(G);
+            gals::local_search(s, 200, R);
+            pop.push_back(s);
+        }
+        gals::MISState C(&G);
+        emit({"gals.repair_and_complete", [&] {
+            const auto& A = pop[R() % pop.size()];
+            C.reset(&G);
+            for (int v = 0; v < G.n; ++v) if (A.in(v) && C.vs.is_free(v) && (R() & 1)) C.add(v);
+        }, [&] { C.repair_and_complete(); }});
+        emit({"gals.crossover", {}, [&] {
+            const auto& A = pop[R() % pop.size()];
+            const auto& B = pop[R() % pop.size()];
+            sink = gals::crossover(A, B, R).size;
+        }});
+    }
+
+    // ---- Ancho de ids / conf (index_width.hpp): mismos kernels con int y uint16_t
+    auto width_kernels = [&](auto V, const string& tag) {
+        using T = typename decltype(V)::type;
+        using SG = sa::GraphT<T, T>;
+        SG G; G.n = gs.n; G.adj = narrow_adjacency<T>(adj); G.compute_degrees();
+        sa::MIS_SA_T<SG> S(G, O.seed);
+        S.quiet = true;
+        S.init_greedy_maximal_improved();
+        uniform_int_distribution<int> U(0, gs.n - 1);
+        emit({"width.sa.add_remove_vertex." + tag, {}, [&] {
+            int v = U(pick);
+            if (S.in(v)) { S.remove_vertex(v); S.add_vertex(v); }
+            else { S.add_vertex(v); S.remove_vertex(v); }
+        }});
+        emit({"width.sa.move." + tag, {}, [&] {
+            int v = U(pick);
+            for (int t = 0; t < 16 && S.in(v); ++t) v = U(pick);
+            if (!S.in(v)) S.apply_move(v);
+            sink = S.curr_size;
+        }});
+
+        using RG = gals::GraphRT<T, T>;
+        RG Gr; Gr.n = gs.n; Gr.adj = narrow_adjacency<T>(adj);
+        gals::RandR R((unsigned)O.seed);
+        vector<gals::MISStateT<RG>> pop;
+        for (int i = 0; i < 8; ++i) pop.push_back(gals::greedy_init(Gr));
+        emit({"width.gals.crossover." + tag, {}, [&] {
+            const auto& A = pop[R() % pop.size()];
+            const auto& B = pop[R() % pop.size()];
+            sink = gals::crossover(A, B, R).size;
+        }});
+    };
+    if (gs.n <= 65536) {
+        width_kernels(TypeTag<int>{}, "w32");
+        width_kernels(TypeTag<uint16_t>{}, "w16");
+    }
+}
+
+// --------------------------------------------------------------------------
+
+static string json_escape(const string& s) {
+    string o;
+    for (char c : s) { if (c == '"' || c == '\\') o += '\\'; o += c; }
+    return o;
+}
+
+static string shell_line(const char* cmd) {
+    string r;
+    FILE* f = popen(cmd, "r");
+    if (!f) return r;
+    char buf[256];
+    if (fgets(buf, sizeof(buf), f)) r = buf;
+    pclose(f);
+    while (!r.empty() && (r.back() == '\n' || r.back() == '\r')) r.pop_back();
+    return r;
+}
+
+static void write_json(const Options& O, const vector<Result>& rs) {
+    ofstream out(O.out);
+    if (!out) { cerr << "No se pudo escribir " << O.out << "\n"; return; }
+    char host[256] = {0};
+    gethostname(host, sizeof(host) - 1);
+    time_t now = time(nullptr);
+    char date[64];
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    out << "{\n  \"meta\": {"
+        << "\"git\": \"" << json_escape(shell_line("git rev-parse --short HEAD 2>/dev/null")) << "\", "
+        << "\"date\": \"" << date << "\", "
+        << "\"host\": \"" << json_escape(host) << "\", "
+        << "\"compiler\": \"" << json_escape(__VERSION__) << "\", "
+        << "\"min_time\": " << O.min_time << ", "
+        << "\"samples\": " << O.samples << ", "
+        << "\"seed\": " << O.seed << "},\n  \"results\": [\n";
+    out << setprecision(10);
+    for (size_t i = 0; i < rs.size(); ++i) {
+        const Result& R = rs[i];
+        Summary S = summarize(R.ns);
+        out << "    {\"kernel\": \"" << R.kernel << "\", \"n\": " << R.n << ", \"p\": " << R.p
+            << ", \"m\": " << R.m
+            << ", \"ns_per_op\": " << S.mean << ", \"stddev\": " << S.stddev
+            << ", \"variance\": " << S.var << ", \"min\": " << S.mn
+            << ", \"median\": " << S.median << ", \"samples\": " << R.ns.size()
+            << ", \"ops_per_sample\": " << R.ops_per_sample;
+        if (R.bytes > 0) out << ", \"bytes\": " << R.bytes << ", \"gb_per_s\": " << R.bytes / S.mean;
+        if (R.l1d_per_op >= 0)
+            out << ", \"l1d_misses_per_op\": " << R.l1d_per_op << ", \"llc_misses_per_op\": " << R.llc_per_op;
+        out << "}"
+            << (i + 1 < rs.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+template <class T>
+static vector<T> parse_list(const string& s) {
+    vector<T> v;
+    stringstream ss(s);
+    string tok;
+    while (getline(ss, tok, ',')) {
+        stringstream ts(tok);
+        T x;
+        if (ts >> x) v.push_back(x);
+    }
+    return v;
+}
+
+int main(int argc, char** argv) {
+    ios::sync_with_stdio(false);
+    Options O;
+    for (int i = 1; i < argc; ++i) {
+        string a = argv[i];
+        if (a == "--out" && i + 1 < argc) O.out = argv[++i];
+        else if (a == "--sizes" && i + 1 < argc) O.sizes = parse_list<int>(argv[++i]);
+        else if (a == "--ps" && i + 1 < argc) O.ps = parse_list<double>(argv[++i]);
+        else if (a == "--kernels" && i + 1 < argc) O.filters = parse_list<string>(argv[++i]);
+        else if (a == "--min_time" && i + 1 < argc) O.min_time = stod(argv[++i]);
+        else if (a == "--samples" && i + 1 < argc) O.samples = max(2, stoi(argv[++i]));
+        else if (a == "--max_kernel_time" && i + 1 < argc) O.max_kernel_time = stod(argv[++i]);
+        else if (a == "--seed" && i + 1 < argc) O.seed = stoull(argv[++i]);
+        else if (a == "--load_threads" && i + 1 < argc) O.load_threads = parse_list<int>(argv[++i]);
+        else if (a == "--perf") O.perf = true;
+        else {
+            cerr << "Unknown or incomplete arg: " << a << "\n";
+            return 1;
+        }
+    }
+
+    PerfThread perf;
+    if (O.perf) {
+        if (perf.open()) g_perf = &perf;
+        else cerr << "#perf: contadores no disponibles (" << strerror(errno) << "); solo ns/op\n";
+    }
+
+    cout << left << setw(34) << "kernel" << right << setw(7) << "n" << setw(6) << "p"
+         << setw(16) << "ns/op" << setw(12) << "stddev" << setw(8) << "samples";
+    if (O.perf) cout << setw(10) << "l1d/op" << setw(10) << "llc/op";
+    cout << "\n";
+    vector<Result> results;
+    for (int n : O.sizes) for (double p : O.ps) {
+        GenSpec gs;
+        gs.n = n; gs.p = p; gs.seed = O.seed;
+        bench_graph(O, gs, results);
+    }
+    if (!O.out.empty()) {
+        write_json(O, results);
+        cerr << "#bench: " << results.size() << " resultados en " << O.out << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,434 @@
+// mis_bench.cpp
+// Driver de benchmark end-to-end: instancias × algoritmos × semillas en un
+// pool de hilos con robo de trabajo, dentro de un solo proceso.
+//
+// Uso (CLI):
+//   ./build/mis-bench -l lista.txt -a greedy,prob:alpha=0.1,sa,ga,gals
+//                     [-t 10] [--seeds 1-30|1,2,3] [--threads T]
+//                     [--prefetch 1] [--outdir results/mis_bench] [--stats json]
+//
+// - lista.txt: una ruta .graph por línea (# comenta); "gen:n,p,seed" genera
+//   un G(n,p) en memoria (gen/gnp.hpp).
+// - Algoritmos (parámetros opcionales separados por ':'):
+//     greedy                              determinista (1 corrida por instancia)
+//     prob[:alpha=0.1]                    greedy RCL-α (Greedy-probabilista)
+//     sa[:T0=2:alpha=0.9995:iters=1000]   build/SA
+//     ga[:pop=..:pc=..:pm=..:elitism=..:stall_gen=..:init=..:ls=0|1]   build/GA
+//     gals[:pop=40:ls_budget=200:ls_freq=10]                           solver_MISP
+// - Cada grafo se carga una vez y lo comparten todas sus corridas. Apenas
+//   se encolan las corridas de una instancia se carga la siguiente, mientras
+//   haya a lo más --prefetch instancias con corridas aún sin empezar: los
+//   hilos libres toman la siguiente sin esperar a que termine la anterior, y
+//   en memoria quedan las que corren más --prefetch + 1 en cola.
+// - Igual que los binarios, SA / GA / GA+LS terminan antes de -t si alcanzan
+//   la cota superior de bounds.hpp.
+//
+// Salida (en --outdir):
+//   runs.csv                      instance,algo,seed,time_limit,mis_size,solve_time
+//   ga_ls_final.csv               esquema de run_ga_ls_final.sh (aggregate_ga_ls.py)
+//   <algo>_runs.csv               instance,seed,time_limit,<parámetros>,mis_size,solve_time
+//   results_greedy_all.csv        n,p,mean_value,mean_time           (make_table.py)
+//   results_prob_aXX_all.csv      n,p,alpha,mean_value,mean_time     (make_table.py)
+// --stats json: línea JSON en stderr con fases (parse / main_loop / output),
+// contadores de operadores sumados sobre todas las corridas y memoria.
+
+#include <bits/stdc++.h>
+#include <sys/stat.h>
+#include "../graph_io.hpp"
+#include "../greedy.hpp"
+#include "../SA.hpp"
+#include "../ga/GA.hpp"
+#include "../final/solver_MISP.hpp"
+#include "../bounds.hpp"
+#include "../gen/gnp.hpp"
+#include "../work_stealing.hpp"
+#include "../telemetry.hpp"
+
+using namespace std;
+
+TEL_DEFINE_ALLOC_HOOKS()
+
+enum Kind { K_GREEDY, K_PROB, K_SA, K_GA, K_GALS };
+
+struct AlgoSpec {
+    Kind kind;
+    string label;                         // nombre en runs.csv / archivo
+    vector<pair<string, string>> params;  // en orden, para las columnas del CSV
+    double alpha = 0.1;                   // prob
+    double T0 = 2.0, sa_alpha = 0.9995;   // sa
+    int iters = 1000;
+    ga::GAParams ga;
+    gals::GALSParams gals;
+};
+
+struct Instance {
+    string name;                          // tal como aparece en la lista
+    int n = 0;
+    double p = 0.0;                       // del nombre erdos_n*_p0c*, o densidad
+    int stop_at = INT_MAX;
+    Graph io;                             // greedy / prob
+    sa::Graph sa;
+    ga::Graph ga;
+    gals::GraphR gals;
+};
+
+struct Row {
+    int inst, algo;
+    unsigned seed;
+    int mis_size;
+    double solve_time;
+};
+
+// ---------------------------------------------------------------------------
+// Parseo
+// ---------------------------------------------------------------------------
+
+static vector<string> split(const string& s, char sep) {
+    vector<string> out;
+    stringstream ss(s);
+    string tok;
+    while (getline(ss, tok, sep)) if (!tok.empty()) out.push_back(tok);
+    return out;
+}
+
+static AlgoSpec parse_algo(const string& spec) {
+    vector<string> parts = split(spec, ':');
+    if (parts.empty()) throw runtime_error("algoritmo vacío");
+    AlgoSpec A;
+    const string& k = parts[0];
+    if (k == "greedy") A.kind = K_GREEDY;
+    else if (k == "prob") A.kind = K_PROB;
+    else if (k == "sa") A.kind = K_SA;
+    else if (k == "ga") A.kind = K_GA;
+    else if (k == "gals") A.kind = K_GALS;
+    else throw runtime_error("algoritmo desconocido: " + k);
+    A.label = k;
+
+    map<string, string> kv;
+    for (size_t i = 1; i < parts.size(); ++i) {
+        size_t eq = parts[i].find('=');
+        if (eq == string::npos) throw runtime_error("parámetro sin '=': " + parts[i]);
+        kv[parts[i].substr(0, eq)] = parts[i].substr(eq + 1);
+    }
+    auto take = [&](const string& key, auto& field) {
+        auto it = kv.find(key);
+        if (it != kv.end()) {
+            stringstream ss(it->second);
+            ss >> field;
+            kv.erase(it);
+        }
+        ostringstream os;
+        os << field;
+        A.params.push_back({key, os.str()});
+    };
+    switch (A.kind) {
+        case K_GREEDY: break;
+        case K_PROB: take("alpha", A.alpha); break;
+        case K_SA: take("T0", A.T0); take("alpha", A.sa_alpha); take("iters", A.iters); break;
+        case K_GA:
+            take("pop", A.ga.pop); take("pc", A.ga.pc); take("pm", A.ga.pm);
+            take("elitism", A.ga.elitism); take("stall_gen", A.ga.stall_gen);
+            take("init", A.ga.init); take("ls", A.ga.ls);
+            break;
+        case K_GALS:
+            take("pop", A.gals.pop_size); take("ls_budget", A.gals.ls_budget);
+            take("ls_freq", A.gals.ls_freq);
+            break;
+    }
+    if (!kv.empty()) throw runtime_error("parámetro desconocido para " + k + ": " + kv.begin()->first);
+    return A;
+}
+
+// "1-30" o "1,2,5"
+static vector<unsigned> parse_seeds(const string& s) {
+    vector<unsigned> out;
+    for (const string& tok : split(s, ',')) {
+        size_t dash = tok.find('-');
+        if (dash == string::npos) out.push_back((unsigned)stoul(tok));
+        else {
+            unsigned a = (unsigned)stoul(tok.substr(0, dash)), b = (unsigned)stoul(tok.substr(dash + 1));
+            for (unsigned x = a; x <= b; ++x) out.push_back(x);
+        }
+    }
+    return out;
+}
+
+static vector<string> read_list(const string& path) {
+    ifstream in(path);
+    if (!in) throw runtime_error("No se pudo abrir la lista: " + path);
+    vector<string> out;
+    string line;
+    while (getline(in, line)) {
+        size_t a = line.find_first_not_of(" \t\r");
+        if (a == string::npos || line[a] == '#') continue;
+        size_t b = line.find_last_not_of(" \t\r");
+        out.push_back(line.substr(a, b - a + 1));
+    }
+    return out;
+}
+
+// n y p desde erdos_n<n>_p0c<p>_*.graph; si no calza, densidad real
+static void parse_np(Instance& I, long long m) {
+    static const regex re("n(\\d+)_p0c([0-9.]+)");
+    smatch mt;
+    const string fname = I.name.substr(I.name.find_last_of('/') + 1);
+    if (regex_search(fname, mt, re)) {
+        I.p = stod(mt[2].str());
+        return;
+    }
+    I.p = I.n > 1 ? 2.0 * (double)m / ((double)I.n * (I.n - 1)) : 0.0;
+}
+
+// Carga una vez (lector del GA: deduplica y acepta DIMACS) y arma solo las
+// representaciones que usan los algoritmos pedidos
+static shared_ptr<Instance> load_instance(const string& name, const vector<AlgoSpec>& algos) {
+    auto I = make_shared<Instance>();
+    I->name = name;
+    vector<vector<int>> adj;
+    if (name.rfind("gen:", 0) == 0) {
+        GenSpec gs = parse_gen_spec(name.substr(4));
+        I->name = gnp_name(gs);
+        I->n = gs.n;
+        adj = gnp_adjacency(gs);
+    } else {
+        ga::Graph g;
+        if (!g.load(name)) throw runtime_error("No pude leer la instancia: " + name);
+        I->n = g.n;
+        adj = move(g.adj);
+    }
+    long long m = 0;
+    for (auto& a : adj) m += (long long)a.size();
+    m /= 2;
+    parse_np(*I, m);
+    I->stop_at = stop_value(compute_upper_bounds(I->n, adj).best(), -1);
+
+    bool need[5] = {false, false, false, false, false};
+    for (auto& A : algos) need[A.kind] = true;
+    if (need[K_GREEDY] || need[K_PROB]) { I->io.n = I->n; I->io.m = m; I->io.adj = adj; }
+    if (need[K_SA]) { I->sa.n = I->n; I->sa.adj = adj; I->sa.compute_degrees(); }
+    if (need[K_GA]) { I->ga.n = I->n; I->ga.adj = adj; }
+    if (need[K_GALS]) { I->gals.n = I->n; I->gals.adj = move(adj); }
+    return I;
+}
+
+// ---------------------------------------------------------------------------
+// Una corrida
+// ---------------------------------------------------------------------------
+
+static pair<int, double> run_one(const Instance& I, const AlgoSpec& A, unsigned seed, double tmax) {
+    switch (A.kind) {
+        case K_GREEDY: { GreedyResult R = greedy_min_degree(I.io); return {R.size, R.time}; }
+        case K_PROB:   { GreedyResult R = greedy_rcl(I.io, A.alpha, seed); return {R.size, R.time}; }
+        case K_SA: {
+            sa::MIS_SA S(I.sa, seed);
+            S.quiet = true;
+            S.stop_at = I.stop_at;
+            S.run(tmax, A.T0, A.sa_alpha, A.iters);
+            return {S.best_size, S.best_time};
+        }
+        case K_GA: {
+            ga::GAResult R = ga::run_ga(I.ga, A.ga, tmax, seed, I.stop_at);
+            return {R.best_fit, R.best_time};
+        }
+        case K_GALS: {
+            gals::GALSResult R = gals::run_ga_ls(I.gals, A.gals, tmax, seed, I.stop_at);
+            return {R.best_size, R.best_time};
+        }
+    }
+    return {0, 0.0};
+}
+
+// ---------------------------------------------------------------------------
+// Salida CSV
+// ---------------------------------------------------------------------------
+
+static string fmt_p(double p) {
+    ostringstream os;
+    os << p;
+    return os.str();
+}
+
+static void write_outputs(const string& dir, const vector<string>& names,
+                          const vector<shared_ptr<Instance>>& meta,
+                          const vector<AlgoSpec>& algos, vector<Row> rows, double tmax) {
+    sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        return tie(a.inst, a.algo, a.seed) < tie(b.inst, b.algo, b.seed);
+    });
+    auto tl = [&](const AlgoSpec& A) { return (A.kind == K_GREEDY || A.kind == K_PROB) ? 0.0 : tmax; };
+
+    {
+        ofstream out(dir + "/runs.csv");
+        out << "instance,algo,seed,time_limit,mis_size,solve_time\n" << setprecision(6) << fixed;
+        for (auto& r : rows)
+            out << names[r.inst] << "," << algos[r.algo].label << "," << r.seed << ","
+                << defaultfloat << tl(algos[r.algo]) << fixed << ","
+                << r.mis_size << "," << r.solve_time << "\n";
+    }
+
+    map<string, int> used;
+    for (size_t a = 0; a < algos.size(); ++a) {
+        const AlgoSpec& A = algos[a];
+        int k = used[A.label]++;
+        string file = (A.kind == K_GALS && k == 0) ? "ga_ls_final.csv"
+                    : A.label + (k ? "_" + to_string(k) : "") + "_runs.csv";
+        ofstream out(dir + "/" + file);
+        out << "instance,seed,time_limit";
+        for (auto& kv : A.params) out << "," << kv.first;
+        out << ",mis_size,solve_time\n";
+        for (auto& r : rows) if (r.algo == (int)a) {
+            out << names[r.inst] << "," << r.seed << "," << tl(A);
+            for (auto& kv : A.params) out << "," << kv.second;
+            out << "," << r.mis_size << "," << fixed << setprecision(6) << r.solve_time
+                << defaultfloat << "\n";
+        }
+
+        // Agregados por (n, p) con el esquema de eval_folder.sh
+        if (A.kind != K_GREEDY && A.kind != K_PROB) continue;
+        map<pair<int, double>, array<double, 3>> agg;   // suma valor, suma tiempo, cuenta
+        for (auto& r : rows) if (r.algo == (int)a) {
+            auto& g = agg[{meta[r.inst]->n, meta[r.inst]->p}];
+            g[0] += r.mis_size; g[1] += r.solve_time; g[2] += 1;
+        }
+        string aggfile;
+        if (A.kind == K_GREEDY) aggfile = "results_greedy_all.csv";
+        else {
+            char buf[64];
+            snprintf(buf, sizeof(buf), "results_prob_a%02d_all.csv", (int)(A.alpha * 100 + 0.5));
+            aggfile = buf;
+        }
+        ofstream ag(dir + "/" + aggfile);
+        ag << (A.kind == K_GREEDY ? "n,p,mean_value,mean_time\n" : "n,p,alpha,mean_value,mean_time\n");
+        for (auto& [key, g] : agg) {
+            ag << key.first << "," << fmt_p(key.second) << ",";
+            if (A.kind == K_PROB) ag << A.alpha << ",";
+            ag << g[0] / g[2] << "," << fixed << setprecision(6) << g[1] / g[2] << defaultfloat << "\n";
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    ios::sync_with_stdio(false);
+    string list_path, algos_s = "greedy", seeds_s = "1", outdir = "results/mis_bench", stats;
+    double tmax = 10.0;
+    int threads = max(1, (int)thread::hardware_concurrency());
+    int prefetch = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        string a = argv[i];
+        if ((a == "-l" || a == "--list") && i + 1 < argc) list_path = argv[++i];
+        else if ((a == "-a" || a == "--algos") && i + 1 < argc) algos_s = argv[++i];
+        else if (a == "-t" && i + 1 < argc) tmax = stod(argv[++i]);
+        else if (a == "--seeds" && i + 1 < argc) seeds_s = argv[++i];
+        else if (a == "--threads" && i + 1 < argc) threads = max(1, stoi(argv[++i]));
+        else if (a == "--prefetch" && i + 1 < argc) prefetch = max(0, stoi(argv[++i]));
+        else if (a == "--outdir" && i + 1 < argc) outdir = argv[++i];
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
+        else {
+            cerr << "Unknown or incomplete arg: " << a << "\n";
+            return 1;
+        }
+    }
+    if (list_path.empty()) {
+        cerr << "Uso: mis-bench -l lista.txt -a greedy,prob:alpha=0.1,sa,ga,gals [-t segs]\n"
+             << "                [--seeds 1-30] [--threads T] [--prefetch k] [--outdir dir]\n"
+             << "                [--stats json]\n";
+        return 1;
+    }
+    if (!tel::enable("mis-bench", stats)) {
+        cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+
+    try {
+        vector<string> names = read_list(list_path);
+        vector<AlgoSpec> algos;
+        for (const string& s : split(algos_s, ',')) algos.push_back(parse_algo(s));
+        vector<unsigned> seeds = parse_seeds(seeds_s);
+        if (names.empty() || algos.empty() || seeds.empty())
+            throw runtime_error("lista, algoritmos o semillas vacíos");
+        mkdir(outdir.c_str(), 0755);
+
+        // Total de corridas (greedy determinista: una por instancia)
+        long long per_inst = 0;
+        for (auto& A : algos) per_inst += (A.kind == K_GREEDY) ? 1 : (long long)seeds.size();
+        const long long total = per_inst * (long long)names.size();
+
+        TEL_PHASE("main_loop");
+        WorkStealingPool pool(threads);
+        mutex mtx;
+        condition_variable cv_queued;
+        int queued = 0;                                 // instancias con corridas sin empezar
+        vector<Row> rows;
+        vector<shared_ptr<Instance>> meta(names.size());  // solo n/p (el grafo se libera)
+        long long done = 0;
+        const double t0 = now_seconds();
+
+        cerr << "#mis-bench: instances=" << names.size() << " algos=" << algos.size()
+             << " seeds=" << seeds.size() << " runs=" << total << " threads=" << threads << "\n";
+
+        // Carga en segundo plano de la instancia siguiente
+        auto loader = [&](size_t i) {
+            return async(launch::async, [&, i] { return load_instance(names[i], algos); });
+        };
+        future<shared_ptr<Instance>> next = loader(0);
+
+        for (size_t i = 0; i < names.size(); ++i) {
+            shared_ptr<Instance> I = next.get();
+            names[i] = I->name;
+            {
+                auto M = make_shared<Instance>();
+                M->name = I->name; M->n = I->n; M->p = I->p;
+                meta[i] = M;
+            }
+            {
+                unique_lock<mutex> lk(mtx);
+                ++queued;
+            }
+
+            auto unstarted = make_shared<atomic<long long>>(per_inst);
+            const int home = (int)(i % pool.size());
+            for (size_t a = 0; a < algos.size(); ++a) {
+                const size_t ns = (algos[a].kind == K_GREEDY) ? 1 : seeds.size();
+                for (size_t s = 0; s < ns; ++s) {
+                    pool.submit([&, I, unstarted, i, a, s] {
+                        if (--*unstarted == 0) {
+                            lock_guard<mutex> lk(mtx);
+                            --queued;
+                            cv_queued.notify_all();
+                        }
+                        auto [val, t] = run_one(*I, algos[a], seeds[s], tmax);
+                        TEL_COUNT("bench.runs", 1);
+                        lock_guard<mutex> lk(mtx);
+                        rows.push_back({(int)i, (int)a, seeds[s], val, t});
+                        ++done;
+                        cerr << "[" << done << "/" << total << "] " << algos[a].label << " "
+                             << I->name << " seed=" << seeds[s] << " -> " << val << " "
+                             << fixed << setprecision(6) << t << defaultfloat << "\n";
+                    }, home);
+                }
+            }
+
+            // Prefetch: con las corridas de esta ya encoladas, la siguiente se
+            // carga mientras haya a lo más --prefetch instancias esperando
+            // hilo (--prefetch 0: cuando todas las de esta ya empezaron)
+            if (i + 1 < names.size()) {
+                unique_lock<mutex> lk(mtx);
+                cv_queued.wait(lk, [&] { return queued <= prefetch; });
+                lk.unlock();
+                next = loader(i + 1);
+            }
+        }
+        pool.wait();
+
+        TEL_PHASE("output");
+        write_outputs(outdir, names, meta, algos, rows, tmax);
+        cerr << "#mis-bench: wall=" << fixed << setprecision(3) << (now_seconds() - t0)
+             << " steals=" << pool.steals() << " outdir=" << outdir << "\n";
+    } catch (const exception& e) {
+        cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <climits>
+
+/**
+ * Cotas superiores baratas para MIS (todas O(n + m)).
+ * Las funciones reciben listas de adyacencia 0-based y deduplicadas, para
+ * poder usarse con los distintos Graph de cada solver.
+ *
+ *  - clique_cover_bound: partición greedy de V en cliques de G (= coloreo
+ *    greedy del complemento). Un independiente toma a lo más un vértice
+ *    por clique, así que α(G) <= #cliques.
+ *  - matching_bound: cota tipo LP para grafos ralos. Con un matching M,
+ *    cada arista de M aporta a lo más un extremo: α(G) <= n - |M|.
+ *  - edge_bound: todo complemento de un independiente es cobertura de
+ *    vértices y cubre a lo más Δ aristas por vértice: α(G) <= n - ⌈m/Δ⌉.
+ */
+struct UpperBounds {
+    int clique_cover = INT_MAX;
+    int matching = INT_MAX;
+    int edges = INT_MAX;
+    int best() const { return std::min(clique_cover, std::min(matching, edges)); }
+};
+
+/**
+ * Valor con el que un solver puede detenerse antes de -t: la cota superior
+ * (ya no hay nada que mejorar) o el objetivo de --target si es menor.
+ */
+inline int stop_value(int ub, int target) {
+    return (target > 0) ? std::min(ub, target) : ub;
+}
+
+// Cobertura por cliques: vértices en orden de grado descendente; cada uno se
+// une a la clique más grande contenida en su vecindad o abre una nueva.
+inline int clique_cover_bound(int n, const std::vector<std::vector<int>>& adj) {
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return adj[a].size() > adj[b].size(); });
+
+    std::vector<int> cl(n, -1);         // clique asignada
+    std::vector<int> csize;             // tamaño de cada clique
+    std::vector<int> hits;              // vecinos de v dentro de cada clique
+    std::vector<int> seen(n, -1);       // sello por vértice (evita contar dos veces)
+    std::vector<int> touched;
+
+    for (int v : order) {
+        touched.clear();
+        for (int u : adj[v]) {
+            if (u == v || seen[u] == v) continue;
+            seen[u] = v;
+            int c = cl[u];
+            if (c < 0) continue;
+            if (hits[c]++ == 0) touched.push_back(c);
+        }
+        int pick = -1;
+        for (int c : touched) {
+            if (hits[c] == csize[c] && (pick < 0 || csize[c] > csize[pick])) pick = c;
+            hits[c] = 0;
+        }
+        if (pick < 0) {
+            pick = (int)csize.size();
+            csize.push_back(0);
+            hits.push_back(0);
+        }
+        cl[v] = pick;
+        ++csize[pick];
+    }
+    return (int)csize.size();
+}
+
+// Matching greedy maximal priorizando vértices de grado bajo
+inline int matching_bound(int n, const std::vector<std::vector<int>>& adj) {
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return adj[a].size() < adj[b].size(); });
+    std::vector<char> matched(n, 0);
+    int M = 0;
+    for (int v : order) {
+        if (matched[v]) continue;
+        int mate = -1;
+        for (int u : adj[v]) {
+            if (u == v || matched[u]) continue;
+            if (mate < 0 || adj[u].size() < adj[mate].size()) mate = u;
+        }
+        if (mate >= 0) { matched[v] = matched[mate] = 1; ++M; }
+    }
+    return n - M;
+}
+
+inline int edge_bound(int n, const std::vector<std::vector<int>>& adj) {
+    long long twice_m = 0;
+    long long dmax = 0;
+    for (int v = 0; v < n; ++v) {
+        twice_m += (long long)adj[v].size();
+        dmax = std::max(dmax, (long long)adj[v].size());
+    }
+    if (dmax == 0) return n;
+    long long m = twice_m / 2;
+    return n - (int)((m + dmax - 1) / dmax);
+}
+
+inline UpperBounds compute_upper_bounds(int n, const std::vector<std::vector<int>>& adj) {
+    UpperBounds B;
+    B.clique_cover = clique_cover_bound(n, adj);
+    B.matching = matching_bound(n, adj);
+    B.edges = edge_bound(n, adj);
+    return B;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Reporte any-time en varios instantes de una misma corrida (--report_at) y
+ * resumen de convergencia al terminar.
+ *
+ *  - improve(v, t, sol): lo llama el hook on_improve del motor; guarda la
+ *    trayectoria (valor, tiempo) y el hash de la solución incumbente. El
+ *    hash (O(n)) solo se calcula si hay --report_at, que es lo único que lo
+ *    muestra; improve_with(v, t, make_sol) tampoco pide la solución sin él
+ *    (los CLIs la reetiquetan a ids originales, otro O(n) por mejora).
+ *  - Un hilo despierta en cada instante de --report_at y escribe en stderr
+ *      #checkpoint: at=<s> best=<v> best_time=<s> hash=<hex>
+ *    Si la corrida termina antes (cota superior, --target), finish() emite
+ *    los instantes pendientes con el valor final.
+ *  - summary(target) escribe
+ *      #convergence: primal_integral=.. ref=.. ttt=.. t_end=.. improvements=..
+ *    primal_integral = ∫₀^T γ(t) dt con γ(t) = (ref - best(t)) / ref (γ = 1
+ *    antes de la primera solución); ref = target si se dio, si no el mejor
+ *    valor final. ttt = primer instante con best >= ref (-1 si nunca).
+ *
+ * El hash es FNV-1a de 64 bits sobre los ids (0-based, crecientes) de los
+ * vértices en S: dos corridas con el mismo hash tienen la misma solución.
+ */
+template <class Vec>
+inline uint64_t solution_hash(const Vec& inS) {
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t v = 0; v < inS.size(); ++v) {
+        if (!inS[v]) continue;
+        uint64_t x = (uint64_t)v;
+        for (int b = 0; b < 8; ++b) {
+            h ^= (x >> (8 * b)) & 0xff;
+            h *= 1099511628211ULL;
+        }
+    }
+    return h;
+}
+
+// "1,5,10,60" -> {1, 5, 10, 60} (ordenados, positivos)
+inline std::vector<double> parse_report_at(const std::string& s) {
+    std::vector<double> out;
+    std::stringstream ss(s);
+    std::string tok;
+    while (std::getline(ss, tok, ',')) {
+        if (tok.empty()) continue;
+        double x = std::stod(tok);
+        if (x > 0) out.push_back(x);
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+class AnytimeTracker {
+public:
+    explicit AnytimeTracker(std::vector<double> report_at = {}) : at(std::move(report_at)) {}
+    ~AnytimeTracker() { finish(); }
+    AnytimeTracker(const AnytimeTracker&) = delete;
+    AnytimeTracker& operator=(const AnytimeTracker&) = delete;
+
+    // Arranca el reloj (y el hilo de checkpoints si hay instantes)
+    void start() {
+        t0 = std::chrono::steady_clock::now();
+        if (!at.empty()) reporter = std::thread([this] { loop(); });
+    }
+
+    template <class Vec>
+    void improve(int v, double t, const Vec& sol) {
+        improve_with(v, t, [&]() -> const Vec& { return sol; });
+    }
+    template <class F>
+    void improve_with(int v, double t, F&& make_sol) {
+        if (at.empty()) record(v, t, 0, false);
+        else record(v, t, solution_hash(make_sol()), true);
+    }
+    // Sin solución disponible (p.ej. --split): el hash queda sin definir
+    void improve(int v, double t) { record(v, t, 0, false); }
+
+    // Detiene el hilo y emite los checkpoints que no alcanzaron a ocurrir
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            if (finished) return;
+            finished = true;
+            t_end = elapsed();
+        }
+        cv.notify_all();
+        if (reporter.joinable()) reporter.join();
+        std::lock_guard<std::mutex> lk(mtx);
+        while (next < at.size()) emit(at[next++]);
+    }
+
+    void summary(int target) {
+        std::lock_guard<std::mutex> lk(mtx);
+        const int best = traj.empty() ? 0 : traj.back().first;
+        const double ref = target > 0 ? (double)target : (double)best;
+        double integral = 0.0, ttt = -1.0, prev_t = 0.0, gap = 1.0;
+        for (auto& [v, t] : traj) {
+            const double tt = std::min(std::max(t, prev_t), t_end);
+            integral += gap * (tt - prev_t);
+            prev_t = tt;
+            gap = ref > 0 ? std::max(0.0, (ref - v) / ref) : 0.0;
+            if (ttt < 0 && v >= ref) ttt = t;
+        }
+        integral += gap * std::max(0.0, t_end - prev_t);
+        std::cerr << "#convergence: primal_integral=" << std::fixed << std::setprecision(6) << integral
+                  << " ref=" << (long long)ref
+                  << " ttt=" << ttt
+                  << " t_end=" << t_end
+                  << " improvements=" << traj.size() << "\n";
+    }
+
+private:
+    std::vector<double> at;
+    size_t next = 0;
+    std::vector<std::pair<int, double>> traj;   // (valor, tiempo) por mejora
+    uint64_t best_hash = 0;
+    bool has_hash = false;
+    double t_end = 0.0;
+    bool finished = false;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::thread reporter;
+
+    double elapsed() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    void record(int v, double t, uint64_t h, bool with_hash) {
+        std::lock_guard<std::mutex> lk(mtx);
+        if (!traj.empty() && v <= traj.back().first) return;
+        traj.push_back({v, t});
+        best_hash = h;
+        has_hash = with_hash;
+    }
+
+    // Requiere mtx tomado
+    void emit(double ck) {
+        const int best = traj.empty() ? 0 : traj.back().first;
+        const double bt = traj.empty() ? 0.0 : traj.back().second;
+        char hex[20] = "-";
+        if (has_hash) snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)best_hash);
+        std::cerr << "#checkpoint: at=" << ck << " best=" << best
+                  << " best_time=" << std::fixed << std::setprecision(6) << bt
+                  << std::defaultfloat << " hash=" << hex << "\n" << std::flush;
+    }
+
+    void loop() {
+        std::unique_lock<std::mutex> lk(mtx);
+        while (next < at.size()) {
+            auto deadline = t0 + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                     std::chrono::duration<double>(at[next]));
+            if (cv.wait_until(lk, deadline, [this] { return finished; })) return;
+            emit(at[next++]);
+        }
+    }
+};
@@ -0,0 +1,247 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include "utils.hpp"
+#include "bounds.hpp"
+#include "thread_pool.hpp"
+#include "exact/bbmc.hpp"
+
+/**
+ * Descomposición en componentes conexas para MIS.
+ * α(G) = Σ α(C_i), así que cada componente se resuelve por separado:
+ *  - componentes pequeñas (<= exact_max vértices): B&B exacto (bbmc.hpp) con
+ *    un límite corto, en el pool de hilos; si no cierra, queda su mejor cota
+ *    inferior. El límite de cada una se recorta a lo que queda de tmax, y
+ *    con la parada levantada (tiempo o señal) las que faltan se quedan con
+ *    el greedy, así que esta fase tampoco pasa de -t.
+ *  - componentes grandes: parten de un greedy y se reparten en un pool de
+ *    hilos, cada una con un presupuesto proporcional a su tamaño, usando el
+ *    motor del solver que llama (SA, GA o GA+LS).
+ * La salida any-time reporta la suma de los incumbentes por componente, que
+ * en todo momento corresponde a una solución factible del grafo completo.
+ */
+
+struct Components {
+    std::vector<int> comp;                  // comp[v] = id de componente
+    std::vector<std::vector<int>> members;  // vértices (ids globales) por componente
+    int count() const { return (int)members.size(); }
+};
+
+inline Components connected_components(int n, const std::vector<std::vector<int>>& adj) {
+    Components C;
+    C.comp.assign(n, -1);
+    std::vector<int> stack;
+    for (int s = 0; s < n; ++s) {
+        if (C.comp[s] >= 0) continue;
+        const int id = C.count();
+        C.members.emplace_back();
+        C.comp[s] = id;
+        stack.push_back(s);
+        while (!stack.empty()) {
+            int u = stack.back(); stack.pop_back();
+            C.members[id].push_back(u);
+            for (int w : adj[u]) if (C.comp[w] < 0) { C.comp[w] = id; stack.push_back(w); }
+        }
+    }
+    return C;
+}
+
+// Subgrafo inducido por members con ids locales 0..k-1 (local: scratch de tamaño n)
+inline std::vector<std::vector<int>> induced_adjacency(const std::vector<std::vector<int>>& adj,
+                                                       const std::vector<int>& members,
+                                                       std::vector<int>& local) {
+    const int k = (int)members.size();
+    for (int i = 0; i < k; ++i) local[members[i]] = i;
+    std::vector<std::vector<int>> sub(k);
+    for (int i = 0; i < k; ++i) {
+        sub[i].reserve(adj[members[i]].size());
+        for (int w : adj[members[i]]) sub[i].push_back(local[w]);
+    }
+    return sub;
+}
+
+// Greedy por grado estático ascendente (solución inicial de cada componente)
+inline std::vector<char> greedy_static(const std::vector<std::vector<int>>& adj) {
+    const int n = (int)adj.size();
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return adj[a].size() < adj[b].size(); });
+    std::vector<char> inS(n, 0), blocked(n, 0);
+    for (int v : order) {
+        if (blocked[v]) continue;
+        inS[v] = 1;
+        blocked[v] = 1;
+        for (int w : adj[v]) blocked[w] = 1;
+    }
+    return inS;
+}
+
+struct SplitOptions {
+    double tmax = 10.0;
+    int threads = 1;
+    int exact_max = 64;         // tamaño máximo para el B&B exacto
+    double exact_time = 0.05;   // segundos por componente pequeña
+    unsigned seed = 1;
+    int stop_at = INT_MAX;      // detener al alcanzar este total
+    // Componentes pequeñas ya cerradas (--cache, artifact_cache.hpp): por
+    // vértice, -1 o su valor en la solución óptima; exact_found recibe lo
+    // mismo para esta corrida
+    const int32_t* exact_known = nullptr;
+    std::vector<int32_t>* exact_found = nullptr;
+    // Parada externa (vigía de deadline.hpp); si no, una propia
+    std::atomic<bool>* stop_flag = nullptr;
+};
+
+struct SplitResult {
+    int total = 0;
+    double best_time = 0.0;
+    std::vector<char> sol;      // ids globales
+    int n_components = 0, n_exact = 0, n_large = 0, largest = 0;
+    int proven = 0;             // componentes cerradas al óptimo
+    bool reached = false;
+};
+
+/**
+ * Motor para una componente grande: recibe el subgrafo, el presupuesto, una
+ * semilla, su valor de parada, el flag de parada global y un callback de
+ * mejora (valor). Devuelve la mejor solución (0/1 en ids locales).
+ */
+using LargeSolver = std::function<std::vector<char>(
+    const std::vector<std::vector<int>>& sub, double budget, unsigned seed, int stop_at,
+    const std::atomic<bool>* stop, const std::function<void(int)>& on_improve)>;
+
+inline SplitResult solve_by_components(int n, const std::vector<std::vector<int>>& adj,
+                                       const SplitOptions& opt, const LargeSolver& solve_large,
+                                       const std::function<void(int, double)>& on_total) {
+    const double t0 = now_seconds();
+    auto elapsed = [&] { return now_seconds() - t0; };
+
+    SplitResult R;
+    R.sol.assign(n, 0);
+    Components C = connected_components(n, adj);
+    R.n_components = C.count();
+
+    std::vector<int> local(n, 0);
+    std::vector<int> comp_best(C.count(), 0);
+    if (opt.exact_found) opt.exact_found->assign(n, -1);
+    std::mutex mtx;
+    std::atomic<bool> own_stop{false};
+    std::atomic<bool>& stop = opt.stop_flag ? *opt.stop_flag : own_stop;
+
+    // Suma coherente: solo se actualiza bajo lock y al mejorar una componente
+    auto improve = [&](int c, int v) {
+        std::lock_guard<std::mutex> lk(mtx);
+        if (v <= comp_best[c]) return;
+        R.total += v - comp_best[c];
+        comp_best[c] = v;
+        R.best_time = elapsed();
+        if (on_total) on_total(R.total, R.best_time);
+        if (R.total >= opt.stop_at) { R.reached = true; stop.store(true); }
+    };
+
+    // 1) Componentes pequeñas: exacto en el pool; grandes: greedy inicial.
+    //    Cada tarea escribe solo los vértices y la entrada de su componente;
+    //    el total se suma al final de la fase
+    std::vector<int> large;
+    std::vector<std::vector<std::vector<int>>> large_adj(C.count());
+    std::vector<char> closed(C.count(), 0);
+    {
+        ThreadPool pool(std::max(1, opt.threads));
+        for (int c = 0; c < C.count(); ++c) {
+            const auto& M = C.members[c];
+            R.largest = std::max(R.largest, (int)M.size());
+            if (M.size() == 1) {
+                R.sol[M[0]] = 1; comp_best[c] = 1;
+                ++R.n_exact; ++R.proven;
+                continue;
+            }
+            const bool small = (int)M.size() <= opt.exact_max;
+            if (small && opt.exact_known && opt.exact_known[M[0]] >= 0) {
+                for (int v : M) if (opt.exact_known[v] > 0) { R.sol[v] = 1; ++comp_best[c]; }
+                if (opt.exact_found) for (int v : M) (*opt.exact_found)[v] = R.sol[v];
+                ++R.n_exact; ++R.proven;
+                continue;
+            }
+            auto sub = induced_adjacency(adj, M, local);
+            if (small) {
+                ++R.n_exact;
+                pool.submit([&, c, sub = std::move(sub)] {
+                    const auto& M = C.members[c];
+                    const double left = opt.tmax - elapsed();
+                    if (stop.load() || left <= 0.0) {
+                        // Sin tiempo: queda el greedy (factible y maximal)
+                        auto g = greedy_static(sub);
+                        for (int i = 0; i < (int)M.size(); ++i) if (g[i]) { R.sol[M[i]] = 1; ++comp_best[c]; }
+                        return;
+                    }
+                    BBMC bb((int)M.size(), sub);
+                    const bool done = bb.solve(std::min(opt.exact_time, left));
+                    for (int i : bb.best_set) R.sol[M[i]] = 1;
+                    if (done) {
+                        closed[c] = 1;
+                        if (opt.exact_found) for (int v : M) (*opt.exact_found)[v] = R.sol[v];
+                    }
+                    comp_best[c] = bb.best;
+                });
+            } else {
+                auto g = greedy_static(sub);
+                for (int i = 0; i < (int)M.size(); ++i) if (g[i]) { R.sol[M[i]] = 1; ++comp_best[c]; }
+                large.push_back(c);
+                large_adj[c] = std::move(sub);
+            }
+        }
+        pool.wait();
+    }
+    for (int c = 0; c < C.count(); ++c) { R.total += comp_best[c]; R.proven += closed[c]; }
+    R.n_large = (int)large.size();
+    R.best_time = elapsed();
+    if (on_total) on_total(R.total, R.best_time);
+    if (R.total >= opt.stop_at) { R.reached = true; return R; }
+    if (large.empty()) return R;
+
+    // 2) Componentes grandes en el pool (la más grande primero), con
+    //    presupuesto proporcional al tamaño sobre T hilos
+    std::sort(large.begin(), large.end(), [&](int a, int b) {
+        return C.members[a].size() > C.members[b].size();
+    });
+    long long large_total = 0;
+    for (int c : large) large_total += (long long)C.members[c].size();
+    const int T = std::max(1, std::min(opt.threads, (int)large.size()));
+    const double remaining = std::max(0.0, opt.tmax - elapsed());
+
+    {
+        ThreadPool pool(T);
+        for (int c : large) {
+            double share = (double)C.members[c].size() / (double)large_total;
+            double budget = std::min(remaining, remaining * T * share);
+            pool.submit([&, c, budget] {
+                if (stop.load()) return;
+                const auto& sub = large_adj[c];
+                int cub = clique_cover_bound((int)sub.size(), sub);
+                std::vector<char> s = solve_large(sub, budget, opt.seed + (unsigned)c, cub, &stop,
+                                                  [&, c](int v) { improve(c, v); });
+                int val = (int)std::count(s.begin(), s.end(), 1);
+                std::lock_guard<std::mutex> lk(mtx);
+                // Reemplaza al greedy solo si la solución del motor es mejor
+                int prev = 0;
+                for (int x : C.members[c]) prev += R.sol[x];
+                if (val > prev) {
+                    const auto& M = C.members[c];
+                    for (int i = 0; i < (int)M.size(); ++i) R.sol[M[i]] = s[i];
+                }
+                if (std::max(val, prev) >= cub) ++R.proven;
+            });
+        }
+        pool.wait();
+    }
+
+    // El total final es el de las soluciones ensambladas
+    R.total = (int)std::count(R.sol.begin(), R.sol.end(), 1);
+    return R;
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include "graph_io.hpp"
+#include "gen/gnp.hpp"
+#include "hugepages.hpp"
+
+/**
+ * Grafo en formato CSR (compressed sparse row), solo lectura.
+ * - off[u] .. off[u+1]-1: posiciones de los vecinos de u en nbr
+ * - Offsets de 64 bits: 2m puede superar 2^31 en grafos grandes.
+ * Pensado para los recorridos paralelos (memoria contigua, sin punteros).
+ * Con --hugepages off y nbr van en la arena de páginas de 2 MB.
+ */
+struct CSR {
+    int n = 0;
+    huge::vector<int64_t> off;  // tamaño n+1
+    huge::vector<int> nbr;      // tamaño 2m
+
+    int degree(int u) const { return (int)(off[u + 1] - off[u]); }
+    const int* begin(int u) const { return nbr.data() + off[u]; }
+    const int* end(int u) const { return nbr.data() + off[u + 1]; }
+};
+
+inline CSR to_csr(const Graph& G) {
+    CSR C;
+    C.n = G.n;
+    C.off.assign((size_t)G.n + 1, 0);
+    for (int u = 0; u < G.n; ++u) C.off[u + 1] = C.off[u] + (int64_t)G.adj[u].size();
+    C.nbr.resize((size_t)C.off[G.n]);
+    for (int u = 0; u < G.n; ++u)
+        std::copy(G.adj[u].begin(), G.adj[u].end(), C.nbr.begin() + C.off[u]);
+    return C;
+}
+
+// Compacta cada fila a sus fill[u] primeros vecinos (ordenados y sin repetir
+// si dedupe) y recalcula off
+inline void csr_compact(CSR& C, const std::vector<uint32_t>& fill, bool dedupe) {
+    int64_t w = 0, start = 0;
+    for (int u = 0; u < C.n; ++u) {
+        const int64_t next = C.off[u + 1];
+        int* b = C.nbr.data() + start;
+        int* e = b + fill[u];
+        if (dedupe) {
+            if (!std::is_sorted(b, e)) std::sort(b, e);
+            e = std::unique(b, e);
+        }
+        C.off[u] = w;
+        if (b != C.nbr.data() + w) std::copy(b, e, C.nbr.data() + w);
+        w += e - b;
+        start = next;
+    }
+    C.off[C.n] = w;
+    C.nbr.resize((size_t)w);
+}
+
+// csr_compact de la carga en paralelo: las posiciones sin escribir quedan en
+// -1. Cada hilo compacta su rango de filas al principio de su tramo de nbr, y
+// después los tramos se juntan en orden.
+inline void csr_compact_parallel(CSR& C, int T, bool dedupe) {
+    const std::vector<int> cut = gload::balanced_cuts(T, C.n, [&](int u) { return C.off[u + 1] - C.off[u]; });
+    std::vector<int64_t> from(T), len(T);
+    std::vector<std::exception_ptr> err;
+    gload::run_threads(T, err, [&](int t) {
+        const int lo = cut[t], hi = cut[t + 1];
+        int64_t w = C.off[lo], start = C.off[lo];
+        from[t] = w;
+        for (int u = lo; u < hi; ++u) {
+            const int64_t next = C.off[u + 1];   // off[hi] no lo escribe nadie
+            int* b = C.nbr.data() + start;
+            int* e = C.nbr.data() + next;
+            if (dedupe) {
+                if (!std::is_sorted(b, e)) std::sort(b, e);
+                e = std::unique(b, e);
+                b = std::lower_bound(b, e, 0);
+            } else {
+                e = std::remove(b, e, -1);
+            }
+            if (u != lo) C.off[u] = w;
+            if (b != C.nbr.data() + w) std::copy(b, e, C.nbr.data() + w);
+            w += e - b;
+            start = next;
+        }
+        len[t] = w - from[t];
+    });
+    gload::rethrow_first(err);
+    std::vector<int64_t> shift(T);
+    int64_t w = 0;
+    for (int t = 0; t < T; ++t) {
+        if (from[t] != w) std::memmove(C.nbr.data() + w, C.nbr.data() + from[t], (size_t)len[t] * sizeof(int));
+        shift[t] = from[t] - w;
+        w += len[t];
+    }
+    gload::run_threads(T, err, [&](int t) {
+        if (shift[t]) for (int u = cut[t]; u < cut[t + 1]; ++u) C.off[u] -= shift[t];
+    });
+    C.off[C.n] = w;
+    C.nbr.resize((size_t)w);
+}
+
+// load_csr en T hilos (graph_load.hpp): cursores por trozo desde los
+// histogramas, llenado sin atómicos y compactación en paralelo
+inline gload::ParLoad load_csr_parallel(const gload::MappedFile& F, const std::string& path, GraphDialect d,
+                                        int T, size_t mem_limit, CSR& C) {
+    std::vector<gload::DegreeCount> H;
+    gload::EdgeScan S;
+    long long base = 0;
+    const gload::ParLoad r = gload::par_count_pass(F, path, d, T, H, C.n, base, S, mem_limit);
+    if (r != gload::ParLoad::Done) return r;
+    size_t hist_bytes = 0;
+    gload::histogram_total(H, C.n, base, &hist_bytes);
+    C.off.assign((size_t)C.n + 1, 0);
+    gload::histograms_to_cursors(H, C.n, base, [&](int u, uint32_t k) { C.off[u + 1] = C.off[u] + k; });
+    check_mem_limit(((size_t)C.n + 1) * sizeof(int64_t) + (size_t)C.off[C.n] * sizeof(int) + hist_bytes,
+                    mem_limit, "el CSR");
+    C.nbr.assign((size_t)C.off[C.n], -1);
+    const long long m = gload::par_fill_pass(F, path, d, T, C.n, base, [&](int t, int u, int v) {
+        C.nbr[C.off[u] + H[t].cnt[(size_t)(u + base)]++] = v;
+    });
+    H = std::vector<gload::DegreeCount>();
+    const bool dedupe = d != GraphDialect::Plain;
+    if (dedupe || 2 * m != C.off[C.n]) csr_compact_parallel(C, T, dedupe);
+    return gload::ParLoad::Done;
+}
+
+/**
+ * CSR directo desde archivo, sin pasar por vector<vector> (graph_load.hpp):
+ * la primera pasada cuenta grados, off sale de la suma prefija y la segunda
+ * escribe cada vecino en su fila con un cursor por vértice. El pico es el
+ * CSR final más un contador de 32 bits por vértice. Lanza std::runtime_error
+ * si no se puede leer o si supera mem_limit (bytes, 0 = sin límite). Con
+ * --load_threads > 1 usa load_csr_parallel.
+ */
+inline CSR load_csr(const std::string& path, GraphDialect d = GraphDialect::Plain, size_t mem_limit = 0) {
+    CSR C;
+    {
+        gload::MappedFile F(path);
+        if (F.data && F.size >= gload::kParMinBytes) {
+            const gload::ParLoad r = load_csr_parallel(F, path, d, load_threads(), mem_limit, C);
+            if (r == gload::ParLoad::Done) return C;
+            if (r == gload::ParLoad::NotGraph) throw std::runtime_error("No se pudo leer: " + path);
+            C = CSR{};
+        }
+    }
+    gload::DegreeCount D;
+    D.mem_limit = mem_limit;
+    gload::EdgeScan S;
+    long long base = 0;
+    if (!gload::count_pass(path, d, D, C.n, base, S)) throw std::runtime_error("No se pudo leer: " + path);
+    C.off.assign((size_t)C.n + 1, 0);
+    for (int u = 0; u < C.n; ++u) C.off[u + 1] = C.off[u] + D.of(u, base);
+    D.cnt = std::vector<uint32_t>();
+    check_mem_limit(((size_t)C.n + 1) * sizeof(int64_t) + (size_t)C.off[C.n] * sizeof(int) +
+                    (size_t)C.n * sizeof(uint32_t), mem_limit, "el CSR");
+    C.nbr.resize((size_t)C.off[C.n]);
+    std::vector<uint32_t> fill(C.n, 0);
+    gload::scan(path, d, S, [&](long long u, long long v) {
+        u -= base;
+        v -= base;
+        if (u < 0 || v < 0 || u >= C.n || v >= C.n || u == v) return;
+        C.nbr[C.off[u] + fill[u]++] = (int)v;
+        C.nbr[C.off[v] + fill[v]++] = (int)u;
+    });
+    csr_compact(C, fill, d != GraphDialect::Plain);
+    return C;
+}
+
+// G(n,p) directo a CSR con dos pasadas del generador (gen/gnp.hpp); m_out: aristas
+inline CSR gnp_csr(const GenSpec& g, long long* m_out = nullptr, size_t mem_limit = 0) {
+    CSR C;
+    C.n = g.n;
+    C.off.assign((size_t)g.n + 1, 0);
+    long long m = 0;
+    gnp_for_each_edge(g, [&](int v, int w) { ++C.off[v + 1]; ++C.off[w + 1]; ++m; });
+    for (int u = 0; u < g.n; ++u) C.off[u + 1] += C.off[u];
+    check_mem_limit(((size_t)g.n + 1) * sizeof(int64_t) + (size_t)C.off[g.n] * sizeof(int) +
+                    (size_t)g.n * sizeof(uint32_t), mem_limit, "el CSR");
+    C.nbr.resize((size_t)C.off[g.n]);
+    std::vector<uint32_t> fill(g.n, 0);
+    gnp_for_each_edge(g, [&](int v, int w) {
+        C.nbr[C.off[v] + fill[v]++] = w;
+        C.nbr[C.off[w] + fill[w]++] = v;
+    });
+    if (m_out) *m_out = m;
+    return C;
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <signal.h>
+
+/**
+ * Plazo de la corrida y cancelación (-t en SA, GA y solver_MISP).
+ *
+ * Los motores sondeaban el reloj cada uno a su modo: SA cada 512
+ * movimientos, GA por hijo y por generación, GA+LS en cada iteración. Algo
+ * lento entre dos consultas (armar la población inicial o un cruce sobre un
+ * grafo grande) pasaba de -t, y un SIGTERM del planificador del clúster
+ * mataba la corrida sin dejar el incumbente.
+ *
+ * Deadline arranca un hilo vigía que duerme hasta t0 + tmax y levanta un
+ * atomic<bool>; los motores lo reciben como stop_flag y lo leen (load
+ * relajado, una línea de caché compartida que casi nunca cambia) en sus
+ * bucles internos. SIGINT y SIGTERM levantan el mismo flag: la corrida sale
+ * por el camino normal y escribe la línea final "<best> <time>", --out_sol y
+ * --best_known. Una segunda señal mata como siempre (SA_RESETHAND).
+ *
+ * finish() detiene al vigía y mide cuánto se pasó la corrida de -t; report()
+ * lo escribe en stderr: "#deadline: limit=.. elapsed=.. overrun=..
+ * cause=time|signal|none" (none: terminó antes, por cota o --target).
+ */
+class Deadline {
+public:
+    Deadline() = default;
+    Deadline(const Deadline&) = delete;
+    Deadline& operator=(const Deadline&) = delete;
+    ~Deadline() {
+        stop_watchdog();
+        target_.store(nullptr);
+    }
+
+    // Arranca el reloj de -t y, si signals, toma SIGINT / SIGTERM
+    void start(double tmax, bool signals = true) {
+        limit_ = tmax;
+        t0_ = std::chrono::steady_clock::now();
+        if (signals) install_handlers(&flag_);
+        watchdog_ = std::thread([this] {
+            std::unique_lock<std::mutex> lk(mtx_);
+            const auto until = t0_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                         std::chrono::duration<double>(limit_));
+            if (!cv_.wait_until(lk, until, [this] { return done_; })) {
+                expired_.store(true, std::memory_order_relaxed);
+                flag_.store(true, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    // Flag para los motores (stop_flag / SplitOptions::stop_flag)
+    std::atomic<bool>* flag() { return &flag_; }
+
+    // Señal recibida (0 si ninguna)
+    int signal() const { return signal_.load(); }
+
+    void finish() {
+        if (finished_) return;
+        elapsed_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0_).count();
+        finished_ = true;
+        stop_watchdog();
+    }
+
+    double elapsed() const { return elapsed_; }
+    double overrun() const { return elapsed_ > limit_ ? elapsed_ - limit_ : 0.0; }
+
+    void report() const {
+        const char* cause = signal() ? "signal" : expired_.load() ? "time" : "none";
+        std::cerr << std::fixed << std::setprecision(6) << "#deadline: limit=" << limit_
+                  << " elapsed=" << elapsed_ << " overrun=" << overrun() << std::defaultfloat
+                  << std::setprecision(6) << " cause=" << cause;
+        if (signal()) std::cerr << " signal=" << signal();
+        std::cerr << "\n";
+    }
+
+private:
+    std::atomic<bool> flag_{false};
+    std::atomic<bool> expired_{false};
+    double limit_ = 0.0, elapsed_ = 0.0;
+    bool finished_ = false;
+    std::chrono::steady_clock::time_point t0_;
+    std::thread watchdog_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool done_ = false;
+
+    void stop_watchdog() {
+        if (!watchdog_.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            done_ = true;
+        }
+        cv_.notify_all();
+        watchdog_.join();
+    }
+
+    // Estado del manejador: atomics libres de lock con inicialización
+    // constante (async-signal-safe)
+    static inline std::atomic<std::atomic<bool>*> target_{nullptr};
+    static inline std::atomic<int> signal_{0};
+
+    static void on_signal(int sig) {
+        signal_.store(sig);
+        if (std::atomic<bool>* f = target_.load()) f->store(true, std::memory_order_relaxed);
+    }
+
+    // Los manejadores quedan hasta el final: una señal durante la salida no la corta
+    static void install_handlers(std::atomic<bool>* f) {
+        target_.store(f);
+        struct sigaction sa {};
+        sigemptyset(&sa.sa_mask);
+        sa.sa_handler = on_signal;
+        sa.sa_flags = SA_RESETHAND | SA_RESTART;
+        sigaction(SIGINT, &sa, nullptr);
+        sigaction(SIGTERM, &sa, nullptr);
+    }
+};
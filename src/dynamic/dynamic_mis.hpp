@@ -0,0 +1,507 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../graph_io.hpp"
+#include "../greedy.hpp"
+#include "../vertex_state.hpp"
+#include "../telemetry.hpp"
+
+/**
+ * MIS dinámico: mantiene un conjunto independiente maximal mientras el grafo
+ * cambia por inserciones y borrados de aristas y de vértices (build/mis-dynamic).
+ *
+ * El estado es el mismo de los motores (vertex_state.hpp: 2·conf + in por
+ * vértice) sobre listas de adyacencia sin ordenar, que se editan con
+ * push_back / swap-erase. Cada actualización se repara en su vecindario:
+ *
+ *  - +e u v con u, v ∈ S: sale el extremo con más vecinos 1-tight (los que
+ *    quedan libres al sacarlo; empate: el de mayor grado) y se completa a
+ *    maximal alrededor de él;
+ *  - -e u v: los extremos que quedan libres entran a S;
+ *  - -v u: si u estaba en S se completa alrededor de sus ex vecinos;
+ *  - +v u w..: u entra si queda libre (ids nuevos agrandan los arreglos).
+ *
+ * Después, una búsqueda local acotada (swaps (1,2) de Andrade-Resende-Werneck:
+ * sacar x ∈ S y meter dos vecinos 1-tight de x no adyacentes entre sí) parte
+ * de los vértices tocados y de los que entran; ls_budget limita las
+ * evaluaciones por actualización, así que la latencia no depende de n.
+ */
+namespace dyn {
+
+enum class UpdateKind { InsertEdge, DeleteEdge, InsertVertex, DeleteVertex };
+
+struct Update {
+    UpdateKind kind = UpdateKind::InsertEdge;
+    int u = 0, v = 0;       // v: solo en aristas
+    std::vector<int> nb;    // +v: vecinos del vértice
+};
+
+/**
+ * Flujo de actualizaciones en texto, ids 0-based (los del .graph):
+ *   + u v   (o +e)   agrega la arista u-v
+ *   - u v   (o -e)   borra la arista u-v
+ *   +v u [w ...]     agrega (o revive) el vértice u con aristas a w ...
+ *   -v u             borra el vértice u y sus aristas
+ * Una línea vacía o "." cierra el lote; con batch > 0 también se corta cada
+ * batch actualizaciones. "#" y "c" abren comentarios. Una línea mal formada
+ * lanza std::runtime_error con su número.
+ */
+class UpdateReader {
+public:
+    UpdateReader(std::istream& in, int batch) : in_(in), batch_(batch) {}
+
+    // Siguiente lote; false si el flujo terminó sin más actualizaciones
+    bool next(std::vector<Update>& out) {
+        out.clear();
+        std::string line;
+        while (std::getline(in_, line)) {
+            ++line_no_;
+            const size_t b = line.find_first_not_of(" \t\r");
+            if (b == std::string::npos || (line[b] == '.' && b == line.find_last_not_of(" \t\r"))) {
+                if (!out.empty()) return true;
+                continue;
+            }
+            const char c = line[b];
+            if (c == '#' || (c == 'c' && (b + 1 == line.size() || line[b + 1] == ' '))) continue;
+            out.push_back(parse(line));
+            if (batch_ > 0 && (int)out.size() >= batch_) return true;
+        }
+        return !out.empty();
+    }
+
+private:
+    std::istream& in_;
+    int batch_;
+    long long line_no_ = 0;
+
+    [[noreturn]] void fail(const std::string& why) const {
+        throw std::runtime_error("actualizaciones, línea " + std::to_string(line_no_) + ": " + why);
+    }
+    int read_id(std::istringstream& ss) const {
+        long long x;
+        if (!(ss >> x)) fail("falta un id de vértice");
+        if (x < 0 || x > 2147483646LL) fail("id fuera de rango: " + std::to_string(x));
+        return (int)x;
+    }
+
+    Update parse(const std::string& line) const {
+        std::istringstream ss(line);
+        std::string op;
+        ss >> op;
+        Update up;
+        if (op == "+" || op == "+e" || op == "-" || op == "-e") {
+            up.kind = op[0] == '+' ? UpdateKind::InsertEdge : UpdateKind::DeleteEdge;
+            up.u = read_id(ss);
+            up.v = read_id(ss);
+        } else if (op == "+v") {
+            up.kind = UpdateKind::InsertVertex;
+            up.u = read_id(ss);
+            while (ss >> std::ws, !ss.eof()) up.nb.push_back(read_id(ss));
+        } else if (op == "-v") {
+            up.kind = UpdateKind::DeleteVertex;
+            up.u = read_id(ss);
+        } else {
+            fail("operación desconocida: " + op);
+        }
+        ss >> std::ws;
+        if (!ss.eof()) fail("sobra texto al final");
+        return up;
+    }
+};
+
+/**
+ * Flujo sintético para medir (--random K en mis-dynamic): sobre el grafo
+ * vivo, 45% +e entre vértices al azar, 45% -e de una arista existente, 5% -v
+ * y 5% +v con un id nuevo y tantos vecinos al azar como el grado medio de
+ * los vivos.
+ */
+class RandomUpdates {
+public:
+    RandomUpdates(long long total, uint64_t seed) : left_(total), rng_(seed) {}
+
+    // Cada actualización se sortea sobre el estado ya actualizado (aplicar antes de pedir la siguiente)
+    template <class Dyn>
+    bool next(const Dyn& D, Update& up) {
+        if (left_ <= 0) return false;
+        --left_;
+        up = make(D);
+        return true;
+    }
+
+private:
+    long long left_;
+    std::mt19937_64 rng_;
+
+    int pick(int n) { return (int)(rng_() % (uint64_t)n); }
+
+    template <class Dyn>
+    int alive_vertex(const Dyn& D) {
+        for (int t = 0; t < 64; ++t) {
+            const int v = pick(D.n());
+            if (D.alive(v)) return v;
+        }
+        return pick(D.n());
+    }
+
+    template <class Dyn>
+    Update make(const Dyn& D) {
+        Update up;
+        const int r = pick(100);
+        if (r < 45) {
+            up.kind = UpdateKind::InsertEdge;
+            up.u = alive_vertex(D);
+            up.v = alive_vertex(D);
+        } else if (r < 90) {
+            up.kind = UpdateKind::DeleteEdge;
+            for (int t = 0; t < 64; ++t) {
+                up.u = alive_vertex(D);
+                const auto& a = D.neighbors(up.u);
+                if (a.empty()) continue;
+                up.v = a[pick((int)a.size())];
+                break;
+            }
+        } else if (r < 95) {
+            up.kind = UpdateKind::DeleteVertex;
+            up.u = alive_vertex(D);
+        } else {
+            up.kind = UpdateKind::InsertVertex;
+            up.u = D.n();
+            const int k = (int)std::min<long long>(2 * D.m() / std::max(1, D.alive_count()), D.n());
+            for (int i = 0; i < k; ++i) up.nb.push_back(alive_vertex(D));
+        }
+        return up;
+    }
+};
+
+struct DynStats {
+    long long updates = 0;    // aplicadas (incluye las ignoradas)
+    long long ignored = 0;    // sin efecto: arista repetida / inexistente, vértice muerto, ...
+    long long evicted = 0;    // vértices sacados de S por una arista nueva
+    long long swaps = 0;      // swaps (1,2) aplicados
+    long long ls_evals = 0;   // vértices de S evaluados por la búsqueda local
+};
+
+class DynamicMIS {
+public:
+    // Toma las listas de G (se ordenan o no, da igual) y todos los vértices vivos
+    explicit DynamicMIS(Graph&& G, int ls_budget = 64)
+        : adj_(std::move(G.adj)), m_(G.m), ls_budget_(ls_budget) {
+        adj_.resize(G.n);
+        alive_.assign(G.n, 1);
+        alive_n_ = G.n;
+        st_.assign(G.n);
+        mark_.assign(G.n, 0);
+        seen_.assign(G.n, 0);
+    }
+
+    int n() const { return (int)adj_.size(); }
+    int alive_count() const { return alive_n_; }
+    long long m() const { return m_; }
+    int size() const { return size_; }
+    bool alive(int v) const { return alive_[v]; }
+    bool in(int v) const { return st_.in(v); }
+    const std::vector<int>& neighbors(int v) const { return adj_[v]; }
+    const DynStats& stats() const { return stats_; }
+
+    // Greedy de grado mínimo (greedy.hpp) sobre el grafo actual
+    void init_greedy() {
+        Graph G;
+        G.n = n();
+        G.adj.swap(adj_);
+        GreedyResult R = greedy_min_degree(G);
+        adj_.swap(G.adj);
+        init_solution(R.sol);
+    }
+
+    // Solución dada: entra cada vértice vivo que siga libre y se completa a maximal
+    void init_solution(const std::vector<int>& sol) {
+        st_.clear();
+        size_ = 0;
+        for (int v : sol)
+            if (v >= 0 && v < n() && alive_[v] && st_.is_free(v)) add(v);
+        for (int v = 0; v < n(); ++v)
+            if (alive_[v] && st_.is_free(v)) add(v);
+    }
+
+    // Búsqueda local sin tope desde todos los vértices de S, hasta que no mejore (al arrancar)
+    void improve_all() {
+        long long before;
+        do {
+            before = stats_.swaps;
+            begin_update();
+            for (int v = 0; v < n(); ++v) if (st_.in(v)) push(v);
+            local_search(-1);
+        } while (stats_.swaps > before);
+    }
+
+    // Aplica una actualización y repara; false si no cambió nada
+    bool apply(const Update& up) {
+        ++stats_.updates;
+        begin_update();
+        bool changed = false;
+        switch (up.kind) {
+            case UpdateKind::InsertEdge:   changed = insert_edge(up.u, up.v); break;
+            case UpdateKind::DeleteEdge:   changed = delete_edge(up.u, up.v); break;
+            case UpdateKind::InsertVertex: changed = insert_vertex(up.u, up.nb); break;
+            case UpdateKind::DeleteVertex: changed = delete_vertex(up.u); break;
+        }
+        if (!changed) { ++stats_.ignored; return false; }
+        local_search(ls_budget_);
+        return true;
+    }
+
+    // Vértices de S en orden creciente
+    std::vector<int> solution() const {
+        std::vector<int> sol;
+        sol.reserve(size_);
+        for (int v = 0; v < n(); ++v) if (st_.in(v)) sol.push_back(v);
+        return sol;
+    }
+
+    // Vértices vivos renumerados 0..k-1 (old_id[nuevo] = id actual)
+    Graph snapshot(std::vector<int>* old_id = nullptr) const {
+        std::vector<int> id(n(), -1);
+        Graph G;
+        for (int v = 0; v < n(); ++v) if (alive_[v]) id[v] = G.n++;
+        G.m = m_;
+        G.adj.resize(G.n);
+        if (old_id) old_id->assign(G.n, 0);
+        for (int v = 0; v < n(); ++v) {
+            if (!alive_[v]) continue;
+            if (old_id) (*old_id)[id[v]] = v;
+            auto& a = G.adj[id[v]];
+            a.reserve(adj_[v].size());
+            for (int w : adj_[v]) a.push_back(id[w]);
+            std::sort(a.begin(), a.end());
+        }
+        return G;
+    }
+
+    // Vacío si S es independiente y maximal sobre los vivos y conf/size/m cuadran
+    std::string check() const {
+        long long deg_sum = 0;
+        int cnt = 0;
+        for (int v = 0; v < n(); ++v) {
+            const std::string at = " (v=" + std::to_string(v) + ")";
+            if (!alive_[v]) {
+                if (!adj_[v].empty() || !st_.is_free(v)) return "vértice borrado con estado" + at;
+                continue;
+            }
+            int c = 0;
+            for (int w : adj_[v]) {
+                if (w == v || !alive_[w]) return "arista a sí mismo o a un vértice borrado" + at;
+                c += st_.in(w);
+            }
+            deg_sum += (long long)adj_[v].size();
+            if (c != st_.conf(v)) return "conf desincronizado" + at;
+            if (st_.in(v) && c) return "S no es independiente" + at;
+            if (!st_.in(v) && !c) return "S no es maximal" + at;
+            cnt += st_.in(v);
+        }
+        if (cnt != size_) return "tamaño desincronizado";
+        if (deg_sum != 2 * m_) return "m desincronizado";
+        return "";
+    }
+
+private:
+    std::vector<std::vector<int>> adj_;
+    std::vector<char> alive_;
+    PackedVertexState<int> st_;
+    long long m_ = 0;
+    int alive_n_ = 0;
+    int size_ = 0;
+    int ls_budget_;
+    DynStats stats_;
+
+    // Candidatos de la búsqueda local de la actualización en curso
+    std::vector<int> queue_;
+    std::vector<uint32_t> seen_;
+    uint32_t epoch_ = 0;
+    // Marcas del swap (1,2): L y vecinos del primer elegido
+    std::vector<uint32_t> mark_;
+    uint32_t stamp_ = 0;
+    std::vector<int> L_, fresh_;
+
+    bool valid(int v) const { return v >= 0 && v < n() && alive_[v]; }
+
+    void add(int v) { st_.add(v, adj_[v]); ++size_; }
+    void drop(int v) { st_.remove(v, adj_[v]); --size_; }
+
+    bool has_edge(int u, int v) const {
+        const auto& a = adj_[u].size() <= adj_[v].size() ? adj_[u] : adj_[v];
+        const int x = adj_[u].size() <= adj_[v].size() ? v : u;
+        return std::find(a.begin(), a.end(), x) != a.end();
+    }
+    static void erase_from(std::vector<int>& a, int x) {
+        auto it = std::find(a.begin(), a.end(), x);
+        if (it == a.end()) return;
+        *it = a.back();
+        a.pop_back();
+    }
+
+    void grow(int n_new) {
+        adj_.resize(n_new);
+        alive_.resize(n_new, 0);
+        st_.resize(n_new);
+        mark_.resize(n_new, 0);
+        seen_.resize(n_new, 0);
+    }
+
+    void begin_update() {
+        queue_.clear();
+        if (++epoch_ == 0) { std::fill(seen_.begin(), seen_.end(), 0); epoch_ = 1; }
+    }
+    uint32_t new_stamp() {
+        if (++stamp_ == 0) { std::fill(mark_.begin(), mark_.end(), 0); stamp_ = 1; }
+        return stamp_;
+    }
+
+    // Candidato: x ∈ S, o x 1-tight (se resuelve a su único vecino en S)
+    void push(int x) {
+        if (seen_[x] == epoch_) return;
+        seen_[x] = epoch_;
+        queue_.push_back(x);
+    }
+
+    // Entran los vecinos de x que quedaron libres, por grado creciente
+    void complete_around(int x) {
+        fresh_.clear();
+        for (int w : adj_[x]) if (alive_[w] && st_.is_free(w)) fresh_.push_back(w);
+        std::sort(fresh_.begin(), fresh_.end(), [&](int a, int b) {
+            return adj_[a].size() != adj_[b].size() ? adj_[a].size() < adj_[b].size() : a < b;
+        });
+        for (int w : fresh_) if (st_.is_free(w)) { add(w); push(w); }
+    }
+    // Tras sacar x de S: sus vecinos que quedaron 1-tight abren swaps nuevos
+    void push_tight_around(int x) {
+        if (st_.conf(x) == 1) push(x);
+        for (int w : adj_[x]) if (st_.word[w] == 2) push(w);
+    }
+
+    // Vecinos de x ∈ S que solo tienen a x en S
+    int tight_count(int x) const {
+        int c = 0;
+        for (int w : adj_[x]) c += st_.word[w] == 2;
+        return c;
+    }
+
+    bool insert_edge(int u, int v) {
+        if (u == v || !valid(u) || !valid(v) || has_edge(u, v)) return false;
+        int out = -1;
+        if (st_.in(u) && st_.in(v)) {
+            const int tu = tight_count(u), tv = tight_count(v);
+            if (tu != tv) out = tu > tv ? u : v;
+            else if (adj_[u].size() != adj_[v].size()) out = adj_[u].size() > adj_[v].size() ? u : v;
+            else out = std::max(u, v);
+        }
+        adj_[u].push_back(v);
+        adj_[v].push_back(u);
+        ++m_;
+        st_.link(u, v);
+        if (out >= 0) {
+            drop(out);
+            ++stats_.evicted;
+            complete_around(out);
+            push_tight_around(out);
+        }
+        push(u);
+        push(v);
+        return true;
+    }
+
+    bool delete_edge(int u, int v) {
+        if (u == v || !valid(u) || !valid(v) || !has_edge(u, v)) return false;
+        erase_from(adj_[u], v);
+        erase_from(adj_[v], u);
+        --m_;
+        st_.unlink(u, v);
+        for (int x : {u, v}) {
+            if (st_.is_free(x)) add(x);
+            push(x);
+        }
+        return true;
+    }
+
+    bool delete_vertex(int u) {
+        if (!valid(u)) return false;
+        const bool was_in = st_.in(u);
+        if (was_in) drop(u);
+        for (int w : adj_[u]) erase_from(adj_[w], u);
+        m_ -= (long long)adj_[u].size();
+        if (was_in) {
+            complete_around(u);
+            for (int w : adj_[u]) if (st_.word[w] == 2) push(w);
+        }
+        std::vector<int>().swap(adj_[u]);
+        alive_[u] = 0;
+        --alive_n_;
+        st_.word[u] = 0;
+        return true;
+    }
+
+    bool insert_vertex(int u, const std::vector<int>& nb) {
+        if (u < 0) return false;
+        bool changed = false;
+        if (u >= n()) grow(u + 1);
+        if (!alive_[u]) { alive_[u] = 1; ++alive_n_; changed = true; }
+        // Con u ya vivo y en S, una arista nueva puede chocar: misma reparación que +e
+        for (int w : nb) changed |= insert_edge(u, w);
+        if (!changed) return false;
+        if (st_.is_free(u)) add(u);
+        push(u);
+        return true;
+    }
+
+    // Swap (1,2) sobre x ∈ S: sale x, entran a, b ∈ L no adyacentes y los
+    // demás de L que queden libres
+    bool two_improve(int x) {
+        L_.clear();
+        for (int w : adj_[x]) if (st_.word[w] == 2) L_.push_back(w);
+        if (L_.size() < 2) return false;
+        for (int a : L_) {
+            const uint32_t s = new_stamp();
+            for (int y : adj_[a]) mark_[y] = s;
+            for (int b : L_) {
+                if (b == a || mark_[b] == s) continue;
+                drop(x);
+                add(a);
+                add(b);
+                push(a);
+                push(b);
+                for (int w : L_) if (st_.is_free(w)) { add(w); push(w); }
+                push_tight_around(x);
+                ++stats_.swaps;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // budget < 0: sin tope
+    void local_search(int budget) {
+        int evals = 0;
+        for (size_t head = 0; head < queue_.size() && (budget < 0 || evals < budget); ++head) {
+            int x = queue_[head];
+            if (!alive_[x]) continue;
+            if (!st_.in(x)) {
+                if (st_.word[x] != 2) continue;
+                int y = -1;
+                for (int w : adj_[x]) if (st_.in(w)) { y = w; break; }
+                if (seen_[y] == epoch_) continue;   // ya en la cola
+                seen_[y] = epoch_;
+                x = y;
+            }
+            ++evals;
+            two_improve(x);
+        }
+        stats_.ls_evals += evals;
+    }
+};
+
+} // namespace dyn
@@ -0,0 +1,207 @@
+// mis_dynamic.cpp
+// MIS sobre un grafo que cambia: carga un grafo base y una solución, lee un
+// flujo de actualizaciones y repara S localmente después de cada una
+// (dynamic_mis.hpp).
+//
+// Uso (CLI):
+//   ./build/mis-dynamic -i <graph_file>|--gen n,p,seed
+//                       [--updates archivo|-] [--random K] [--seed s]
+//                       [--sol ruta.txt] [--batch K] [--ls_budget B]
+//                       [--init_ls 0|1] [--out_sol ruta.txt] [--check]
+//                       [--recompute] [--stats json]
+//
+// - --updates: flujo "+ u v", "- u v", "+v u w..", "-v u" (ids 0-based; "-" =
+//   stdin). Los lotes se cierran con una línea vacía o "."; --batch K corta
+//   además cada K actualizaciones.
+// - --random K: K actualizaciones sintéticas (RandomUpdates) en lotes de
+//   --batch (defecto 1000), con semilla --seed.
+// - --sol: solución inicial (1-indexed, la de --out_sol de GA / MIS-exact);
+//   se descartan los vértices en conflicto y se completa a maximal. Sin
+//   --sol: greedy de grado mínimo. --init_ls 1 (defecto) la mejora con swaps
+//   (1,2) antes de leer el flujo.
+// - --ls_budget B: evaluaciones de la búsqueda local por actualización
+//   (defecto 64; 0 = solo reparar).
+//
+// Salida:
+//   stdout: una línea por lote
+//           "batch=.. updates=.. size=.. n=.. m=.. us=.. us_per_update=.. max_us=.."
+//           (us: microsegundos de aplicar y reparar, sin contar la lectura)
+//   stderr: "#init: size=.. time=.." y al final
+//           "#dynamic: updates=.. ignored=.. batches=.. size=.. p50_us=.. p99_us=..
+//            max_us=.. evicted=.. swaps=.. ls_evals=.."
+//           --check: "#check: ok" o el primer error (sale con código 3)
+//           --recompute: "#recompute: greedy=.. time=.." (greedy desde cero
+//           sobre el grafo final, para comparar tamaños)
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "dynamic_mis.hpp"
+#include "../graph_io.hpp"
+#include "../greedy.hpp"
+#include "../utils.hpp"
+#include "../gen/gnp.hpp"
+#include "../telemetry.hpp"
+#include "../solution_io.hpp"
+
+TEL_DEFINE_ALLOC_HOOKS()
+
+// S como lista de ids (DynamicMIS::solution), no como pertenencia 0/1
+static void write_solution_ids(const std::string& path, const std::vector<int>& S) {
+    std::ofstream out(path);
+    if (!out) return;
+    for (size_t i = 0; i < S.size(); ++i) {
+        if (i) out << " ";
+        out << (S[i] + 1);
+    }
+    out << "\n";
+}
+
+static double percentile(std::vector<float>& v, double q) {
+    if (v.empty()) return 0.0;
+    const size_t k = std::min(v.size() - 1, (size_t)(q * (double)(v.size() - 1) + 0.5));
+    std::nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k];
+}
+
+int main(int argc, char** argv) {
+    std::ios::sync_with_stdio(false);
+    std::string in_path, gen, updates, sol_path, out_sol, stats;
+    long long random_updates = 0;
+    unsigned long long seed = 1;
+    int batch = 0, ls_budget = 64, load_threads = 0;
+    bool init_ls = true, check = false, recompute = false;
+    size_t mem_limit = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if ((a == "-i" || a == "--input") && i + 1 < argc) in_path = argv[++i];
+        else if (a == "--gen" && i + 1 < argc) gen = argv[++i];
+        else if (a == "--updates" && i + 1 < argc) updates = argv[++i];
+        else if (a == "--random" && i + 1 < argc) random_updates = std::stoll(argv[++i]);
+        else if (a == "--seed" && i + 1 < argc) seed = std::stoull(argv[++i]);
+        else if (a == "--sol" && i + 1 < argc) sol_path = argv[++i];
+        else if (a == "--batch" && i + 1 < argc) batch = std::max(0, std::stoi(argv[++i]));
+        else if (a == "--ls_budget" && i + 1 < argc) ls_budget = std::max(0, std::stoi(argv[++i]));
+        else if (a == "--init_ls" && i + 1 < argc) init_ls = std::stoi(argv[++i]) != 0;
+        else if (a == "--out_sol" && i + 1 < argc) out_sol = argv[++i];
+        else if (a == "--check") check = true;
+        else if (a == "--recompute") recompute = true;
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
+        else if (a == "--mem_limit" && i + 1 < argc) mem_limit = parse_mem_limit(argv[++i]);
+        else if (a == "--load_threads" && i + 1 < argc) load_threads = std::stoi(argv[++i]);
+        else {
+            std::cerr << "Unknown or incomplete arg: " << a << "\n";
+            return 1;
+        }
+    }
+    if ((in_path.empty() && gen.empty()) || (updates.empty() && random_updates <= 0)) {
+        std::cerr << "Uso: mis-dynamic -i <graph_file>|--gen n,p,seed (--updates archivo|- | --random K)\n"
+                  << "     [--sol ruta.txt] [--batch K] [--ls_budget B] [--init_ls 0|1] [--seed s]\n"
+                  << "     [--out_sol ruta.txt] [--check] [--recompute] [--stats json]\n";
+        return 1;
+    }
+    if (!tel::enable("mis-dynamic", stats)) {
+        std::cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+    set_load_threads(load_threads);
+
+    try {
+        Graph G;
+        if (!gen.empty()) {
+            GenSpec gs = parse_gen_spec(gen);
+            G.n = gs.n;
+            G.adj = gnp_adjacency(gs, &G.m, mem_limit);
+        } else if (!load_adjacency(in_path, GraphDialect::GA, G.n, G.adj, &G.m, mem_limit)) {
+            throw std::runtime_error("No se pudo abrir: " + in_path);
+        }
+
+        TEL_PHASE("init");
+        double t0 = now_seconds();
+        dyn::DynamicMIS D(std::move(G), ls_budget);
+        if (sol_path.empty()) D.init_greedy();
+        else D.init_solution(read_solution_ids(sol_path));
+        TEL_PHASE("init");   // greedy_min_degree pasa por "main_loop"
+        if (init_ls) D.improve_all();
+        std::cerr << "#init: size=" << D.size() << " time=" << std::fixed << std::setprecision(6)
+                  << (now_seconds() - t0) << "\n";
+        const dyn::DynStats init = D.stats();
+
+        std::ifstream file;
+        if (!updates.empty() && updates != "-") {
+            file.open(updates);
+            if (!file) throw std::runtime_error("No se pudo abrir: " + updates);
+        }
+        std::istream& in = updates == "-" ? std::cin : file;
+        dyn::UpdateReader reader(in, batch);
+        dyn::RandomUpdates synth(random_updates, seed);
+
+        TEL_PHASE("main_loop");
+        std::vector<dyn::Update> B;
+        dyn::Update up;
+        std::vector<float> lat;
+        long long batches = 0;
+        const int per_batch = batch > 0 ? batch : 1000;
+        for (;;) {
+            long long k = 0;
+            double sum = 0.0, mx = 0.0;
+            auto run = [&](const dyn::Update& u) {
+                const auto a = std::chrono::steady_clock::now();
+                D.apply(u);
+                const double us =
+                    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - a).count();
+                lat.push_back((float)us);
+                sum += us;
+                mx = std::max(mx, us);
+                ++k;
+            };
+            if (random_updates > 0) {
+                while (k < per_batch && synth.next(D, up)) run(up);
+            } else if (reader.next(B)) {
+                for (const auto& u : B) run(u);
+            }
+            if (k == 0) break;
+            ++batches;
+            std::cout << "batch=" << batches << " updates=" << k << " size=" << D.size()
+                      << " n=" << D.n() << " m=" << D.m() << std::fixed << std::setprecision(1)
+                      << " us=" << sum << " us_per_update=" << std::setprecision(2) << sum / k
+                      << " max_us=" << std::setprecision(1) << mx << "\n";
+        }
+        std::cout << std::flush;
+
+        TEL_PHASE("output");
+        const dyn::DynStats& st = D.stats();
+        TEL_COUNT("dynamic.updates", st.updates);
+        TEL_COUNT("dynamic.swaps", st.swaps);
+        const double max_us = lat.empty() ? 0.0 : *std::max_element(lat.begin(), lat.end());
+        const double p50 = percentile(lat, 0.50), p99 = percentile(lat, 0.99);
+        std::cerr << "#dynamic: updates=" << st.updates << " ignored=" << st.ignored
+                  << " batches=" << batches << " size=" << D.size() << std::fixed << std::setprecision(1)
+                  << " p50_us=" << p50 << " p99_us=" << p99 << " max_us=" << max_us
+                  << " evicted=" << st.evicted << " swaps=" << st.swaps - init.swaps
+                  << " ls_evals=" << st.ls_evals - init.ls_evals << "\n";
+
+        int rc = 0;
+        if (check) {
+            const std::string why = D.check();
+            std::cerr << "#check: " << (why.empty() ? "ok" : why) << "\n";
+            if (!why.empty()) rc = 3;
+        }
+        if (recompute) {
+            Graph F = D.snapshot();
+            GreedyResult R = greedy_min_degree(F);
+            std::cerr << "#recompute: greedy=" << R.size << " time=" << std::fixed << std::setprecision(6)
+                      << R.time << "\n";
+        }
+        if (!out_sol.empty()) write_solution_ids(out_sol, D.solution());
+        return rc;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,335 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "thread_pool.hpp"
+
+/**
+ * Evaluación por lotes para el tuning con irace (--eval_batch FILE en GA y
+ * solver_MISP): reemplaza un proceso de runner.sh por evaluación.
+ *
+ * FILE: una evaluación por línea (# comenta)
+ *     <config_id> <instancia> <semilla> [parámetros del binario...]
+ *   p.ej.  7 data/.../erdos_n1000_p0c0.1_1.graph 42 --pop 129 --pc 0.99 --ls 1
+ *
+ * - Cada instancia se carga una sola vez y se libera tras su última
+ *   evaluación; las evaluaciones corren en un ThreadPool de --threads hilos
+ *   con el -t del binario (10 s por defecto, como runner.sh).
+ * - Salida (stdout o --eval_out FILE): una línea por evaluación, en el orden
+ *   de FILE, con el valor que devuelve runner.sh (tamaño del MIS).
+ * - --race 1: F-race. Un bloque es un par (instancia, semilla), en orden de
+ *   aparición; las configuraciones vivas se evalúan bloque a bloque y, desde
+ *   --race_min bloques completos, un test de Friedman (α = --race_alpha) con
+ *   post-hoc de Conover (el de irace) elimina las que quedan por detrás de la
+ *   mejor. Sus evaluaciones pendientes no corren y salen como 0 (el valor de
+ *   "sin salida" de runner.sh); stderr lo informa con "#race: ...".
+ */
+
+// ---------------------------------------------------------------------------
+// Distribuciones para el test (Numerical Recipes, §6.2 y §6.4)
+// ---------------------------------------------------------------------------
+
+// Q(a, x) = Γ(a, x) / Γ(a): gamma incompleta regularizada superior
+inline double gamma_q(double a, double x) {
+    if (x <= 0.0) return 1.0;
+    const double lpre = -x + a * std::log(x) - std::lgamma(a);
+    if (x < a + 1.0) {
+        double ap = a, sum = 1.0 / a, del = sum;
+        for (int n = 0; n < 1000; ++n) {
+            ap += 1.0;
+            del *= x / ap;
+            sum += del;
+            if (std::fabs(del) < std::fabs(sum) * 1e-15) break;
+        }
+        return 1.0 - sum * std::exp(lpre);
+    }
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a, c = 1.0 / tiny, d = 1.0 / b, h = d;
+    for (int i = 1; i < 1000; ++i) {
+        const double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b; if (std::fabs(d) < tiny) d = tiny;
+        c = b + an / c; if (std::fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        const double del = d * c;
+        h *= del;
+        if (std::fabs(del - 1.0) < 1e-15) break;
+    }
+    return std::exp(lpre) * h;
+}
+
+// P(χ²_df > x)
+inline double chi2_sf(double x, double df) { return gamma_q(df / 2.0, x / 2.0); }
+
+// I_x(a, b): beta incompleta regularizada
+inline double beta_inc(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+    auto cf = [](double a, double b, double x) {
+        const double tiny = 1e-300;
+        const double qab = a + b, qap = a + 1.0, qam = a - 1.0;
+        double c = 1.0, d = 1.0 - qab * x / qap;
+        if (std::fabs(d) < tiny) d = tiny;
+        d = 1.0 / d;
+        double h = d;
+        for (int m = 1; m < 1000; ++m) {
+            const int m2 = 2 * m;
+            double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+            d = 1.0 + aa * d; if (std::fabs(d) < tiny) d = tiny;
+            c = 1.0 + aa / c; if (std::fabs(c) < tiny) c = tiny;
+            d = 1.0 / d;
+            h *= d * c;
+            aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+            d = 1.0 + aa * d; if (std::fabs(d) < tiny) d = tiny;
+            c = 1.0 + aa / c; if (std::fabs(c) < tiny) c = tiny;
+            d = 1.0 / d;
+            const double del = d * c;
+            h *= del;
+            if (std::fabs(del - 1.0) < 1e-15) break;
+        }
+        return h;
+    };
+    const double bt = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                               a * std::log(x) + b * std::log(1.0 - x));
+    if (x < (a + 1.0) / (a + b + 2.0)) return bt * cf(a, b, x) / a;
+    return 1.0 - bt * cf(b, a, 1.0 - x) / b;
+}
+
+// t tal que P(T_df <= t) = p (p > 0.5), por bisección
+inline double student_t_quantile(double p, double df) {
+    auto cdf = [df](double t) {
+        const double tail = 0.5 * beta_inc(df / 2.0, 0.5, df / (df + t * t));
+        return t >= 0 ? 1.0 - tail : tail;
+    };
+    double lo = 0.0, hi = 1.0;
+    while (cdf(hi) < p && hi < 1e6) hi *= 2.0;
+    for (int it = 0; it < 200; ++it) {
+        const double mid = 0.5 * (lo + hi);
+        (cdf(mid) < p ? lo : hi) = mid;
+    }
+    return 0.5 * (lo + hi);
+}
+
+/**
+ * Friedman + post-hoc de Conover sobre values[bloque][config] (mayor es
+ * mejor). Devuelve las configuraciones (0..k-1) que sobreviven: la de menor
+ * suma de rangos y las que no difieren significativamente de ella.
+ */
+inline std::vector<int> friedman_survivors(const std::vector<std::vector<double>>& values, double alpha) {
+    const int b = (int)values.size(), k = b ? (int)values[0].size() : 0;
+    std::vector<int> all(k);
+    std::iota(all.begin(), all.end(), 0);
+    if (b < 2 || k < 2) return all;
+
+    // Rangos por bloque: 1 = mayor valor, empates promediados
+    std::vector<double> R(k, 0.0);
+    double A = 0.0;
+    std::vector<int> idx(k);
+    for (const auto& row : values) {
+        std::iota(idx.begin(), idx.end(), 0);
+        std::sort(idx.begin(), idx.end(), [&](int x, int y) { return row[x] > row[y]; });
+        for (int i = 0; i < k;) {
+            int j = i;
+            while (j + 1 < k && row[idx[j + 1]] == row[idx[i]]) ++j;
+            const double r = (i + j) / 2.0 + 1.0;
+            for (int t = i; t <= j; ++t) { R[idx[t]] += r; A += r * r; }
+            i = j + 1;
+        }
+    }
+    const double C = b * k * (k + 1.0) * (k + 1.0) / 4.0;
+    if (A - C <= 1e-12) return all;   // todo empatado
+    double S = 0.0, R2 = 0.0;
+    for (double r : R) { S += (r - b * (k + 1.0) / 2.0) * (r - b * (k + 1.0) / 2.0); R2 += r * r; }
+    const double T = (k - 1.0) * S / (A - C);
+    if (chi2_sf(T, k - 1.0) >= alpha) return all;
+
+    const double df = (b - 1.0) * (k - 1.0);
+    const double thr = student_t_quantile(1.0 - alpha / 2.0, df) * std::sqrt(2.0 * (b * A - R2) / df);
+    const double best = *std::min_element(R.begin(), R.end());
+    std::vector<int> keep;
+    for (int j = 0; j < k; ++j) if (R[j] - best <= thr) keep.push_back(j);
+    return keep;
+}
+
+// ---------------------------------------------------------------------------
+// Lote
+// ---------------------------------------------------------------------------
+
+struct EvalTuple {
+    std::string config, instance;
+    unsigned seed = 0;
+    std::vector<std::string> params;
+};
+
+struct EvalBatchOptions {
+    int threads = 1;
+    double tmax = 10.0;
+    bool race = false;
+    double race_alpha = 0.05;
+    int race_min = 5;
+    std::string out;   // vacío: stdout
+};
+
+inline std::vector<EvalTuple> read_eval_batch(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("No se pudo abrir --eval_batch: " + path);
+    std::vector<EvalTuple> out;
+    std::string line;
+    int lineno = 0;
+    while (std::getline(in, line)) {
+        ++lineno;
+        const size_t h = line.find('#');
+        if (h != std::string::npos) line.erase(h);
+        std::istringstream ss(line);
+        EvalTuple e;
+        std::string seed;
+        if (!(ss >> e.config)) continue;
+        if (!(ss >> e.instance >> seed))
+            throw std::runtime_error("--eval_batch línea " + std::to_string(lineno) + ": se espera <config> <instancia> <semilla>");
+        e.seed = (unsigned)std::stoul(seed);
+        for (std::string tok; ss >> tok;) e.params.push_back(tok);
+        out.push_back(std::move(e));
+    }
+    return out;
+}
+
+/**
+ * Corre el lote. load(ruta) -> std::shared_ptr<Inst> (puede lanzar);
+ * parse(params) -> Cfg (lanza si un parámetro es inválido; se valida todo
+ * antes de empezar); eval(inst, cfg, seed, tmax) -> int.
+ * Devuelve el código de salida del binario.
+ */
+template <class Load, class Parse, class Eval>
+inline int run_eval_batch(const std::string& path, const EvalBatchOptions& O,
+                          Load load, Parse parse, Eval eval) {
+    using Cfg = decltype(parse(std::vector<std::string>{}));
+    using InstPtr = decltype(load(std::string{}));
+    const auto t0 = std::chrono::steady_clock::now();
+
+    std::vector<EvalTuple> T;
+    std::vector<Cfg> cfg;
+    try {
+        T = read_eval_batch(path);
+        for (auto& e : T) cfg.push_back(parse(e.params));
+    } catch (const std::exception& ex) {
+        std::cerr << "ERROR: " << ex.what() << "\n";
+        return 1;
+    }
+    const int N = (int)T.size();
+
+    // Configuraciones y bloques (instancia, semilla) en orden de aparición
+    std::map<std::string, int> cfg_id, block_id;
+    std::vector<std::string> cfg_name;
+    std::vector<std::string> block_inst;
+    std::vector<int> tc(N), tb(N);
+    for (int i = 0; i < N; ++i) {
+        auto c = cfg_id.emplace(T[i].config, (int)cfg_name.size());
+        if (c.second) cfg_name.push_back(T[i].config);
+        auto b = block_id.emplace(T[i].instance + '\n' + std::to_string(T[i].seed), (int)block_inst.size());
+        if (b.second) block_inst.push_back(T[i].instance);
+        tc[i] = c.first->second;
+        tb[i] = b.first->second;
+    }
+    const int K = (int)cfg_name.size(), B = (int)block_inst.size();
+    std::vector<std::vector<int>> cell(B, std::vector<int>(K, -1));   // bloque × config -> tupla
+    for (int i = 0; i < N; ++i) cell[tb[i]][tc[i]] = i;
+    std::map<std::string, int> last_block;   // última vez que se usa cada instancia
+    for (int b = 0; b < B; ++b) last_block[block_inst[b]] = b;
+
+    std::vector<int> value(N, 0);
+    std::vector<char> ran(N, 0), alive(K, 1);
+    std::map<std::string, InstPtr> cache;
+    int loaded = 0, runs = 0;
+    ThreadPool pool(O.threads);
+
+    auto instance = [&](const std::string& p) {
+        auto it = cache.find(p);
+        if (it != cache.end()) return it->second;
+        ++loaded;
+        return cache[p] = load(p);
+    };
+    // Encola las tuplas vivas del bloque b; la instancia se suelta con la última tarea
+    auto submit_block = [&](int b) {
+        InstPtr I = instance(block_inst[b]);
+        if (last_block[block_inst[b]] == b) cache.erase(block_inst[b]);
+        for (int c = 0; c < K; ++c) {
+            const int i = cell[b][c];
+            if (i < 0 || !alive[c]) continue;
+            ++runs;
+            ran[i] = 1;
+            pool.submit([&, i, I] { value[i] = eval(*I, cfg[i], T[i].seed, O.tmax); });
+        }
+    };
+
+    try {
+        if (!O.race) {
+            for (int b = 0; b < B; ++b) submit_block(b);
+            pool.wait();
+        } else {
+            std::vector<int> complete;   // bloques con todas las vivas evaluadas
+            for (int b = 0; b < B; ++b) {
+                submit_block(b);
+                pool.wait();
+                complete.clear();
+                std::vector<int> live;
+                for (int c = 0; c < K; ++c) if (alive[c]) live.push_back(c);
+                for (int bb = 0; bb <= b; ++bb) {
+                    bool ok = true;
+                    for (int c : live) ok = ok && cell[bb][c] >= 0 && ran[cell[bb][c]];
+                    if (ok) complete.push_back(bb);
+                }
+                if ((int)live.size() < 2 || (int)complete.size() < O.race_min) continue;
+                std::vector<std::vector<double>> vals;
+                for (int bb : complete) {
+                    vals.emplace_back();
+                    for (int c : live) vals.back().push_back(value[cell[bb][c]]);
+                }
+                std::vector<int> keep = friedman_survivors(vals, O.race_alpha);
+                if (keep.size() == live.size()) continue;
+                std::string gone;
+                std::vector<char> kept(live.size(), 0);
+                for (int j : keep) kept[j] = 1;
+                for (size_t j = 0; j < live.size(); ++j) if (!kept[j]) {
+                    alive[live[j]] = 0;
+                    gone += (gone.empty() ? "" : ",") + cfg_name[live[j]];
+                }
+                std::cerr << "#race: block=" << b + 1 << " complete=" << complete.size()
+                          << " alive=" << keep.size() << " eliminated=" << gone << "\n";
+            }
+        }
+    } catch (const std::exception& ex) {
+        pool.wait();
+        std::cerr << "ERROR: " << ex.what() << "\n";
+        return 2;
+    }
+
+    std::ofstream fout;
+    if (!O.out.empty()) {
+        fout.open(O.out);
+        if (!fout) { std::cerr << "ERROR: No se pudo abrir --eval_out: " << O.out << "\n"; return 1; }
+    }
+    std::ostream& out = O.out.empty() ? std::cout : fout;
+    for (int i = 0; i < N; ++i) out << value[i] << '\n';
+    out.flush();
+
+    if (O.race) {
+        std::string surv;
+        for (int c = 0; c < K; ++c) if (alive[c]) surv += (surv.empty() ? "" : ",") + cfg_name[c];
+        std::cerr << "#race: survivors=" << surv << "\n";
+    }
+    std::cerr << "#eval_batch: tuples=" << N << " runs=" << runs << " skipped=" << N - runs
+              << " configs=" << K << " blocks=" << B << " instances_loaded=" << loaded
+              << " threads=" << O.threads << " time="
+              << std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() << "\n";
+    return 0;
+}
@@ -0,0 +1,103 @@
+// MIS_exact.cpp
+// Solver exacto (branch & bound) para Maximum Independent Set vía clique
+// máximo del complemento, con bitsets y cotas por coloreo (ver bbmc.hpp).
+//
+// Uso (CLI):
+//   ./build/MIS-exact -i <graph_file> -t <seconds> [--out_sol ruta.txt]
+//   (--gen n,p,seed en lugar de -i genera un G(n,p) en memoria)
+//   --stats json: línea JSON en stderr con fases, nodos del B&B y memoria
+//
+// Salida:
+//   stdout: cotas inferiores any-time "<mejor_valor> <tiempo>" y una línea final
+//           con el mejor valor (igual contrato que SA / GA).
+//   stderr: "#ub <cota> <tiempo>" cada vez que baja la cota superior global y
+//           "#bound: lb=.. ub=.. status=optimal|timeout nodes=.." al terminar.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include "../graph_io.hpp"
+#include "../utils.hpp"
+#include "bbmc.hpp"
+#include "../gen/gnp.hpp"
+#include "../telemetry.hpp"
+
+TEL_DEFINE_ALLOC_HOOKS()
+
+static void write_solution_1indexed(const std::string& path, std::vector<int> S) {
+    std::ofstream out(path);
+    if (!out) return;
+    std::sort(S.begin(), S.end());
+    for (size_t i = 0; i < S.size(); ++i) {
+        if (i) out << " ";
+        out << (S[i] + 1);
+    }
+    out << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::ios::sync_with_stdio(false);
+    std::string in_path, out_sol, gen, stats;
+    double tmax = 10.0;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if ((a == "-i" || a == "--input") && i + 1 < argc) in_path = argv[++i];
+        else if (a == "-t" && i + 1 < argc) tmax = std::stod(argv[++i]);
+        else if (a == "--gen" && i + 1 < argc) gen = argv[++i];
+        else if (a == "--out_sol" && i + 1 < argc) out_sol = argv[++i];
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
+        else {
+            std::cerr << "Unknown or incomplete arg: " << a << "\n";
+            return 1;
+        }
+    }
+    if (in_path.empty() && gen.empty()) {
+        std::cerr << "Usage: MIS-exact -i <graph_file>|--gen n,p,seed -t <seconds> [--out_sol ruta.txt] [--stats json]\n";
+        return 1;
+    }
+    if (!tel::enable("MIS-exact", stats)) {
+        std::cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+    if (tmax <= 0) tmax = 1.0;
+
+    try {
+        Graph G;
+        if (!gen.empty()) {
+            GenSpec gs = parse_gen_spec(gen);
+            G.n = gs.n;
+            G.adj = gnp_adjacency(gs, &G.m);
+        } else {
+            G = load_graph(in_path);
+        }
+        TEL_PHASE("preprocessing");
+        BBMC bb(G.n, G.adj);
+
+        double best_time = 0.0;
+        std::cout << std::fixed << std::setprecision(6);
+        bb.on_improve = [&](int best, double t) {
+            best_time = t;
+            std::cout << best << " " << t << "\n" << std::flush;
+        };
+        bb.on_bound = [](int ub, double t) {
+            std::cerr << "#ub " << ub << " " << std::fixed << std::setprecision(6) << t << "\n";
+        };
+
+        TEL_PHASE("main_loop");
+        bool opt = bb.solve(tmax);
+        TEL_PHASE("output");
+        tel::add("exact.nodes", bb.nodes);
+
+        std::cerr << "#bound: lb=" << bb.best << " ub=" << bb.ub
+                  << " status=" << (opt ? "optimal" : "timeout")
+                  << " nodes=" << bb.nodes << "\n";
+        std::cout << bb.best << " " << best_time << "\n";
+        if (!out_sol.empty()) write_solution_1indexed(out_sol, bb.best_set);
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+}
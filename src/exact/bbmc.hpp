@@ -0,0 +1,252 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "../utils.hpp"
+
+/**
+ * Branch & bound exacto para MIS, resuelto como clique máximo del complemento
+ * (estilo BBMC de San Segundo / MCS de Tomita):
+ *  - Adyacencia del complemento en bitsets (n palabras de 64 bits por fila).
+ *  - Orden inicial de degeneración (min-width) y renumeración de vértices,
+ *    de modo que el bit i corresponde al i-ésimo vértice del orden.
+ *  - Cota superior en cada nodo por coloreo greedy secuencial sobre bitsets:
+ *    solo se ramifica sobre vértices con color >= kmin = best - |C| + 1.
+ *  - Cota superior global incremental: en la raíz, al cerrar la rama del
+ *    vértice i, el resto del problema queda acotado por el color del
+ *    siguiente vértice; UB = max(best, color_siguiente).
+ * Con límite de tiempo el resultado es any-time: best (cota inferior) y ub.
+ */
+struct BBMC {
+    using word = uint64_t;
+
+    int n = 0;                 // vértices
+    int W = 0;                 // palabras por fila
+    std::vector<word> comp;    // complemento renumerado, fila i en [i*W, (i+1)*W)
+    std::vector<int> order;    // order[i] = id original del vértice con bit i
+
+    int best = 0;              // mejor clique (= MIS) encontrado
+    std::vector<int> best_set; // ids originales
+    int ub = 0;                // cota superior probada
+    bool optimal = false;
+    long long nodes = 0;
+
+    // Callbacks opcionales para salida any-time
+    std::function<void(int, double)> on_improve;  // (best, t)
+    std::function<void(int, double)> on_bound;    // (ub, t)
+
+    /**
+     * Construye el complemento de G a partir de listas de adyacencia.
+     * Lanza std::runtime_error si los bitsets exceden max_bytes.
+     */
+    BBMC(int n_, const std::vector<std::vector<int>>& adj,
+         std::size_t max_bytes = (std::size_t)1 << 30) : n(n_) {
+        W = (n + 63) / 64;
+        if ((std::size_t)n * (std::size_t)W * sizeof(word) > max_bytes)
+            throw std::runtime_error("Grafo demasiado grande para bitsets (n=" + std::to_string(n) + ")");
+
+        // Vecinos en G deduplicados y sin lazos
+        std::vector<std::vector<int>> nbr(n);
+        for (int u = 0; u < n; ++u) {
+            nbr[u] = adj[u];
+            std::sort(nbr[u].begin(), nbr[u].end());
+            nbr[u].erase(std::unique(nbr[u].begin(), nbr[u].end()), nbr[u].end());
+            nbr[u].erase(std::remove(nbr[u].begin(), nbr[u].end(), u), nbr[u].end());
+        }
+        order = degeneracy_order(nbr);
+
+        std::vector<int> pos(n);
+        for (int i = 0; i < n; ++i) pos[order[i]] = i;
+
+        // Fila i: todos menos i y menos sus vecinos en G
+        comp.assign((std::size_t)n * W, 0);
+        std::vector<word> row(W);
+        for (int i = 0; i < n; ++i) {
+            std::fill(row.begin(), row.end(), ~word(0));
+            if (n % 64) row[W - 1] = (word(1) << (n % 64)) - 1;
+            row[i >> 6] &= ~(word(1) << (i & 63));
+            for (int v : nbr[order[i]]) {
+                int j = pos[v];
+                row[j >> 6] &= ~(word(1) << (j & 63));
+            }
+            std::copy(row.begin(), row.end(), comp.begin() + (std::size_t)i * W);
+        }
+        ub = n;
+    }
+
+    /**
+     * Semilla de cota inferior (p.ej. una solución heurística). Ids originales.
+     */
+    void set_initial(const std::vector<int>& S) {
+        if ((int)S.size() > best) { best = (int)S.size(); best_set = S; }
+    }
+
+    /**
+     * Ejecuta el B&B hasta probar optimalidad o agotar tmax segundos.
+     * Retorna true si la solución es óptima.
+     */
+    bool solve(double tmax) {
+        t_start = now_seconds();
+        t_limit = tmax;
+        aborted = false;
+        if (n == 0) { ub = 0; optimal = true; return true; }
+
+        if (best == 0) greedy_seed();
+
+        // Memoria por profundidad en deques: crecer no invalida las
+        // referencias que mantienen los niveles superiores.
+        pool_U.clear(); pool_P.clear(); pool_list.clear(); pool_col.clear();
+        Q.assign(W, 0);
+        grow(1);
+
+        std::vector<word>& P = pool_P[0];
+        std::fill(P.begin(), P.end(), ~word(0));
+        if (n % 64) P[W - 1] = (word(1) << (n % 64)) - 1;
+        cur.clear();
+        expand(0);
+
+        if (!aborted) { ub = best; optimal = true; }
+        if (on_bound) on_bound(ub, now_seconds() - t_start);
+        return optimal;
+    }
+
+private:
+    double t_start = 0.0, t_limit = 0.0;
+    bool aborted = false;
+    std::vector<int> cur;                          // clique actual (bits)
+    std::deque<std::vector<word>> pool_U, pool_P;  // memoria por profundidad
+    std::deque<std::vector<int>> pool_list, pool_col;
+    std::vector<word> Q;                           // scratch del coloreo
+
+    void grow(int depth) {
+        while ((int)pool_P.size() <= depth) {
+            pool_U.emplace_back(W);
+            pool_P.emplace_back(W);
+            pool_list.emplace_back();
+            pool_col.emplace_back();
+        }
+    }
+
+    static inline bool test(const word* b, int i) { return (b[i >> 6] >> (i & 63)) & 1; }
+    static inline void clear(word* b, int i) { b[i >> 6] &= ~(word(1) << (i & 63)); }
+    inline const word* row(int i) const { return comp.data() + (std::size_t)i * W; }
+
+    // Orden min-width: se extrae repetidamente el vértice de menor grado
+    // (en el complemento) y se ubica al final del orden.
+    static std::vector<int> degeneracy_order(const std::vector<std::vector<int>>& nbrG) {
+        const int n = (int)nbrG.size();
+        // deg_comp(v) = (vivos - 1) - deg_G_vivo(v): basta mantener el grado en G
+        std::vector<int> degG(n);
+        for (int u = 0; u < n; ++u) degG[u] = (int)nbrG[u].size();
+        std::vector<char> alive(n, 1);
+        std::vector<int> out(n);
+        for (int k = n - 1; k >= 0; --k) {
+            // menor grado en complemento == mayor grado vivo en G
+            int sel = -1, sd = -1;
+            for (int u = 0; u < n; ++u)
+                if (alive[u] && degG[u] > sd) { sd = degG[u]; sel = u; }
+            out[k] = sel;
+            alive[sel] = 0;
+            for (int v : nbrG[sel]) if (alive[v]) --degG[v];
+        }
+        return out;
+    }
+
+    // Greedy en el complemento (clique) recorriendo el orden inicial
+    void greedy_seed() {
+        std::vector<word> P(W, ~word(0));
+        if (n % 64) P[W - 1] = (word(1) << (n % 64)) - 1;
+        std::vector<int> S;
+        for (int i = 0; i < n; ++i) {
+            if (!test(P.data(), i)) continue;
+            S.push_back(order[i]);
+            const word* r = row(i);
+            for (int w = 0; w < W; ++w) P[w] &= r[w];
+        }
+        set_initial(S);
+        if (on_improve) on_improve(best, now_seconds() - t_start);
+    }
+
+    bool time_up() {
+        if ((++nodes & 1023) == 0 && now_seconds() - t_start >= t_limit) aborted = true;
+        return aborted;
+    }
+
+    // Coloreo secuencial BBMC: llena list/col solo con vértices de color >= kmin
+    void color_sort(const std::vector<word>& P, std::vector<word>& U,
+                    std::vector<int>& list, std::vector<int>& col, int kmin) {
+        list.clear(); col.clear();
+        U = P;
+        int k = 1;
+        int first = 0;
+        while (true) {
+            while (first < W && U[first] == 0) ++first;
+            if (first == W) break;
+            std::copy(U.begin(), U.end(), Q.begin());
+            int qf = first;
+            while (true) {
+                while (qf < W && Q[qf] == 0) ++qf;
+                if (qf == W) break;
+                int v = (qf << 6) + __builtin_ctzll(Q[qf]);
+                clear(U.data(), v);
+                clear(Q.data(), v);
+                const word* r = row(v);
+                for (int w = qf; w < W; ++w) Q[w] &= ~r[w];
+                if (k >= kmin) { list.push_back(v); col.push_back(k); }
+            }
+            ++k;
+        }
+    }
+
+    void record() {
+        if ((int)cur.size() <= best) return;
+        best = (int)cur.size();
+        best_set.clear();
+        for (int b : cur) best_set.push_back(order[b]);
+        if (on_improve) on_improve(best, now_seconds() - t_start);
+    }
+
+    // P = pool_P[depth]: candidatos del nodo actual
+    void expand(int depth) {
+        if (time_up()) return;
+        grow(depth + 1);
+        std::vector<word>& P = pool_P[depth];
+        std::vector<word>& NP = pool_P[depth + 1];
+        std::vector<int>& list = pool_list[depth];
+        std::vector<int>& col  = pool_col[depth];
+        int kmin = best - (int)cur.size() + 1;
+        if (kmin < 1) kmin = 1;
+        color_sort(P, pool_U[depth], list, col, kmin);
+
+        if (depth == 0) {
+            ub = std::max(best, col.empty() ? 0 : col.back());
+            if (on_bound) on_bound(ub, now_seconds() - t_start);
+        }
+
+        for (int i = (int)list.size() - 1; i >= 0; --i) {
+            if ((int)cur.size() + col[i] <= best) break;
+            int v = list[i];
+            cur.push_back(v);
+            const word* r = row(v);
+            bool empty = true;
+            for (int w = 0; w < W; ++w) { NP[w] = P[w] & r[w]; empty &= (NP[w] == 0); }
+            if (empty) record();
+            else expand(depth + 1);
+            cur.pop_back();
+            if (aborted) return;
+            clear(P.data(), v);
+
+            // Cota global incremental al cerrar una rama de la raíz
+            if (depth == 0) {
+                int nu = std::max(best, (i > 0) ? col[i - 1] : 0);
+                if (nu < ub) {
+                    ub = nu;
+                    if (on_bound) on_bound(ub, now_seconds() - t_start);
+                }
+            }
+        }
+    }
+};
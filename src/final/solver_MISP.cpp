@@ -2,351 +2,227 @@
 // Híbrido MH_p + MH_t para Maximum Independent Set
 // GA + Búsqueda Local (LS)
 // CLI: solver_MISP -i instancia -t tiempo [params]
+//      (--gen n,p,seed en lugar de -i: G(n,p) generado en memoria)
+// --report_at 1,5,10,60: "#checkpoint: ..." en stderr en cada instante y
+// "#convergence: ..." (integral primal, time-to-target) al terminar
+// --stats json: línea JSON en stderr con tiempos por fase, operadores
+// (cruce, mutación, reparación, LS) y memoria (telemetry.hpp)
+// --perf: contadores de hardware por fase, en reparación / LS y por hijo
+// Las líneas any-time las escribe un hilo reportero (trace.hpp); --trace FILE
+// (.csv o binario) guarda además (tiempo, valor, hijos) de cada mejora
 // Any-time output: "<best> <time>"
+// Termina antes de -t al alcanzar la cota superior (bounds.hpp) o --target K;
+// con --target la línea final agrega el gap: "<best> <time> <gap>"
+// --split: GA+LS por componente conexa grande en --threads hilos; las
+// componentes con <= --exact_max vértices se cierran con B&B (components.hpp)
+// --eval_batch FILE: lote de (config, instancia, semilla) para irace, cada
+// instancia cargada una vez y --threads evaluaciones en paralelo; --race 1
+// agrega eliminación tipo F-race (eval_batch.hpp)
+// --width auto: ids de vértice y contadores conf de 16 bits cuando el grafo lo
+// permite (index_width.hpp); --width 32 usa ints
+// --reorder degree|rcm|bfs|none: reetiqueta los vértices al cargar para que
+// los vecinos queden cerca en memoria (reorder.hpp); "#work: children=..
+// per_sec=.." compara el rendimiento entre órdenes
+// --hugepages: población y estado por vértice en páginas de 2 MB, heap del
+// grafo compactado a páginas grandes (hugepages.hpp)
+// --mem_limit 8G: aborta antes de reservar si el grafo no entra; la carga es
+// en dos pasadas, sin copia cruda de aristas (graph_load.hpp)
+// --load_threads T: hilos de la carga (0 = uno por núcleo, 1 = secuencial)
+// --init_sol ruta.txt: solución previa (1-indexed) que reemplaza, reparada,
+// al individuo 0 de la población; --out_sol ruta.txt guarda la mejor.
+// --best_known DIR: almacén de mejores conocidas por hash del grafo
+// (solution_io.hpp); sin --init_sol arranca desde lo guardado y al terminar
+// lo reemplaza si la corrida lo supera
+// --cache DIR: orden de --reorder, cotas y componentes cerradas por el B&B
+// guardados por hash del grafo y reusados, mapeados, en la próxima corrida
+// (artifact_cache.hpp)
+// -t lo vigila un hilo (deadline.hpp) que levanta el flag de parada del
+// motor; SIGINT / SIGTERM también: sale con la línea final, --out_sol y
+// --best_known (código 128 + señal). "#deadline: ..overrun=.." mide cuánto
+// se pasó de -t
 
 #include <bits/stdc++.h>
-#include "../utils.hpp"
+#include "solver_MISP.hpp"
+#include "../gen/gnp.hpp"
+#include "../telemetry.hpp"
+#include "../eval_batch.hpp"
+#include "../pipeline.hpp"
 
 using namespace std;
+using namespace gals;
 
-// =======================
-// Lector robusto (DIMACS / n m / pares)
-// Normaliza a 0-based y deduplica
-// =======================
-struct GraphR {
-    int n = 0;
-    vector<vector<int>> adj;
-
-    static inline string trim(const string& s){
-        size_t a=0,b=s.size();
-        while(a<b && isspace((unsigned char)s[a])) ++a;
-        while(b>a && isspace((unsigned char)s[b-1])) --b;
-        return s.substr(a,b-a);
-    }
-
-    bool load(const string &path) {
-        ifstream in(path);
-        if(!in) return false;
-
-        string line;
-        vector<pair<long long,long long>> raw;
-        long long declared_n = -1;
-        bool in_dimacs=false;
-        bool saw_header_nm=false, saw_header_n=false;
-        long long max_id = LLONG_MIN;
-        bool saw_zero=false;
-
-        while(getline(in,line)){
-            line=trim(line);
-            if(line.empty()) continue;
-            if(line[0]=='c' || line[0]=='#') continue;
-
-            if(line[0]=='p'){
-                in_dimacs=true;
-                string p,name; long long nn=0,mm=0;
-                stringstream ss(line);
-                ss>>p>>name>>nn>>mm;
-                if(nn>0) declared_n=nn;
-                continue;
-            }
-
-            if(in_dimacs){
-                { // e u v
-                    stringstream ss(line);
-                    char t; long long u,v;
-                    if((ss>>t>>u>>v) && (t=='e' || t=='a')){
-                        raw.emplace_back(u,v);
-                        max_id=max(max_id,max(u,v));
-                        if(u==0||v==0) saw_zero=true;
-                        continue;
-                    }
-                }
-                { // u v
-                    stringstream ss(line);
-                    long long u,v;
-                    if((ss>>u>>v)){
-                        raw.emplace_back(u,v);
-                        max_id=max(max_id,max(u,v));
-                        if(u==0||v==0) saw_zero=true;
-                        continue;
-                    }
-                }
-                continue;
-            }
-
-            // no DIMACS
-            {
-                stringstream ss(line);
-                vector<long long> tok;
-                long long x;
-                while(ss>>x) tok.push_back(x);
-
-                if(tok.size()==1 && declared_n<0 && !saw_header_n && !saw_header_nm){
-                    declared_n=tok[0];
-                    saw_header_n=true;
-                    continue;
-                }
-                if(tok.size()==2 && declared_n<0 && !saw_header_nm){
-                    declared_n=tok[0];
-                    saw_header_nm=true;
-                    continue;
-                }
-                if(tok.size()>=2){
-                    long long u=tok[0], v=tok[1];
-                    raw.emplace_back(u,v);
-                    max_id=max(max_id,max(u,v));
-                    if(u==0||v==0) saw_zero=true;
-                    continue;
-                }
-            }
-        }
-
-        if(declared_n<0 && raw.empty()) return false;
-        bool zero_based = saw_zero;
-
-        if(declared_n<0){
-            if(max_id==LLONG_MIN) return false;
-            declared_n = zero_based ? (max_id+1) : (max_id);
-        }
-
-        n=(int)declared_n;
-        if(n<=0) return false;
-
-        adj.assign(n,{});
-        for(auto [uu,vv]: raw){
-            long long u=uu, v=vv;
-            if(!zero_based){ u-=1; v-=1; }
-            if(u<0||v<0||u>=n||v>=n||u==v) continue;
-            adj[(int)u].push_back((int)v);
-            adj[(int)v].push_back((int)u);
-        }
-        for(int i=0;i<n;i++){
-            auto &A=adj[i];
-            sort(A.begin(),A.end());
-            A.erase(unique(A.begin(),A.end()),A.end());
-        }
-        return true;
-    }
-};
-
-
-// =======================
-// Estado MIS reutilizable
-// =======================
-struct MISState {
-    const GraphR* G;
-    vector<char> inS;
-    vector<int> conf;
-    int size;
-
-    MISState(const GraphR* g=nullptr) { reset(g); }
-
-    void reset(const GraphR* g){
-        G = g;
-        inS.assign(G->n, 0);
-        conf.assign(G->n, 0);
-        size = 0;
-    }
-
-    void add(int v){
-        inS[v] = 1;
-        size++;
-        for(int u : G->adj[v]) conf[u]++;
-    }
-
-    void remove(int v){
-        inS[v] = 0;
-        size--;
-        for(int u : G->adj[v]) conf[u]--;
-    }
-
-    // Reparación + completar a maximal
-    void repair_and_complete(){
-        vector<int> deg(G->n);
-        for(int i=0;i<G->n;i++) deg[i] = G->adj[i].size();
-
-        bool changed = true;
-        while(changed){
-            changed = false;
-            for(int v=0;v<G->n;v++){
-                if(inS[v] && conf[v]>0){
-                    remove(v);
-                    changed = true;
-                }
-            }
-        }
-        for(int v=0;v<G->n;v++){
-            if(!inS[v] && conf[v]==0) add(v);
-        }
-    }
-};
-
-// =======================
-// Greedy simple (init)
-// =======================
-MISState greedy_init(const GraphR& G){
-    MISState S(&G);
-    vector<int> order(G.n);
-    iota(order.begin(), order.end(), 0);
-    sort(order.begin(), order.end(),
-         [&](int a,int b){ return G.adj[a].size() < G.adj[b].size(); });
+TEL_DEFINE_ALLOC_HOOKS()
 
-    for(int v : order){
-        if(S.conf[v]==0) S.add(v);
-    }
-    return S;
+// Parámetros del GA+LS (los que ajusta irace); compartidos por la CLI y --eval_batch
+static bool is_gals_param(const string& a){
+    return a=="--pop" || a=="--ls_budget" || a=="--ls_k" || a=="--ls_freq";
+}
+static void set_gals_param(GALSParams& P, const string& a, const string& v){
+    if(a=="--pop") P.pop_size = stoi(v);
+    else if(a=="--ls_budget") P.ls_budget = stoi(v);
+    else if(a=="--ls_k") P.ls_k = stoi(v);
+    else if(a=="--ls_freq") P.ls_freq = stoi(v);
 }
 
-// =======================
-// Búsqueda Local (MH_t)
-// 1-exchange simple
-// =======================
-void local_search(MISState& S, int budget){
-    int n = S.G->n;
-    for(int it=0; it<budget; it++){
-        int v = rand() % n;
-        if(S.inS[v]) continue;
-
-        bool ok = true;
-        for(int u : S.G->adj[v]){
-            if(S.inS[u]){ ok=false; break; }
-        }
-        if(ok){
-            S.add(v);
-        }
+// --eval_batch: "--pop 79 --ls_budget 444 ..." -> GALSParams
+static GALSParams parse_batch_params(const vector<string>& tok){
+    GALSParams P;
+    for(size_t k=0; k<tok.size(); ++k){
+        if(!is_gals_param(tok[k]) || k+1>=tok.size())
+            throw runtime_error("--eval_batch: parámetro inválido: " + tok[k]);
+        try{ set_gals_param(P, tok[k], tok[k+1]); }
+        catch(const logic_error&){ throw runtime_error("--eval_batch: valor inválido para " + tok[k] + ": " + tok[k+1]); }
+        ++k;
     }
+    return P;
 }
 
+struct BatchInstance {
+    GraphR G;
+    int stop_at = INT_MAX;
+};
 
-// =======================
-// Selección por torneo
-// =======================
-int tournament(const vector<MISState>& pop){
-    int a = rand() % pop.size();
-    int b = rand() % pop.size();
-    return (pop[a].size > pop[b].size) ? a : b;
-}
-
-// =======================
-// Cruce uniforme
-// =======================
-MISState crossover(const MISState& A, const MISState& B){
-    MISState C(A.G);
-    for(int v=0; v<A.G->n; v++){
-        if(rand() & 1){
-            if(A.inS[v] && C.conf[v]==0) C.add(v);
-        }else{
-            if(B.inS[v] && C.conf[v]==0) C.add(v);
-        }
-    }
-    C.repair_and_complete();
-    return C;
+static int run_batch(const string& path, const EvalBatchOptions& O){
+    auto load = [](const string& p){
+        auto I = make_shared<BatchInstance>();
+        if(!I->G.load(p)) throw runtime_error("No se pudo leer grafo: " + p);
+        I->stop_at = compute_upper_bounds(I->G.n, I->G.adj).best();
+        return I;
+    };
+    auto eval = [](const BatchInstance& I, const GALSParams& P, unsigned seed, double tmax){
+        return run_ga_ls(I.G, P, tmax, seed, I.stop_at).best_size;
+    };
+    return run_eval_batch(path, O, load, parse_batch_params, eval);
 }
 
 // =======================
 // MAIN
 // =======================
 int main(int argc, char** argv){
-    string instance;
+    string instance, gen;
     double Tlimit = 10.0;
-    int pop_size = 40;
-    int ls_budget = 200;
+    GALSParams P;
     int seed = 1;
-    int ls_k = 4;
-    int ls_freq = 10;
+    int target = -1;
+    bool split = false;
+    int threads = max(1, (int)thread::hardware_concurrency());
+    int exact_max = 64;
+    vector<double> report_at;
+    string stats;
+    bool perf = false;
+    string trace;
+    string eval_batch;
+    EvalBatchOptions batch;
+    string width = "auto";
+    string reorder = "none";
+    bool hugepages = false;
+    size_t mem_limit = 0;
+    int load_threads = 0;
+    string init_sol, best_known, out_sol, cache_dir;
     
     for(int i=1;i<argc;i++){
         string a = argv[i];
         if(a=="-i") instance = argv[++i];
+        else if(a=="--gen") gen = argv[++i];
         else if(a=="-t") Tlimit = stod(argv[++i]);
-        else if(a=="--pop") pop_size = stoi(argv[++i]);
-        else if(a=="--ls_budget") ls_budget = stoi(argv[++i]);
+        else if(is_gals_param(a)) set_gals_param(P, a, argv[++i]);
         else if(a=="--seed") seed = stoi(argv[++i]);
-	else if(a=="--ls_k") ls_k = stoi(argv[++i]);
-	else if(a=="--ls_freq") ls_freq = stoi(argv[++i]);
-    }
-
-    srand(seed);
-
-    GraphR G;
-	if(!G.load(instance)){
-    		cerr << "ERROR: No se pudo leer grafo: " << instance << "\n";
-   	 return 1;
-	}
-
-    double t0 = now_seconds();
-
-    // =======================
-    // Inicialización población
-    // =======================
-    vector<MISState> pop;
-    for(int i=0;i<pop_size;i++){
-        pop.push_back(greedy_init(G));
+        else if(a=="--target") target = stoi(argv[++i]);
+        else if(a=="--report_at") report_at = parse_report_at(argv[++i]);
+        else if(a=="--stats") stats = argv[++i];
+        else if(a=="--split") split = true;
+        else if(a=="--perf") perf = true;
+        else if(a=="--trace") trace = argv[++i];
+        else if(a=="--threads") threads = max(1, stoi(argv[++i]));
+        else if(a=="--exact_max") exact_max = stoi(argv[++i]);
+        else if(a=="--eval_batch") eval_batch = argv[++i];
+        else if(a=="--width") width = argv[++i];
+        else if(a=="--reorder") reorder = argv[++i];
+        else if(a=="--hugepages") hugepages = true;
+        else if(a=="--mem_limit") mem_limit = parse_mem_limit(argv[++i]);
+        else if(a=="--load_threads") load_threads = stoi(argv[++i]);
+        else if(a=="--init_sol") init_sol = argv[++i];
+        else if(a=="--best_known") best_known = argv[++i];
+        else if(a=="--out_sol") out_sol = argv[++i];
+        else if(a=="--cache") cache_dir = argv[++i];
+        else if(a=="--eval_out") batch.out = argv[++i];
+        else if(a=="--race") batch.race = (string(argv[++i])!="0");
+        else if(a=="--race_alpha") batch.race_alpha = stod(argv[++i]);
+        else if(a=="--race_min") batch.race_min = max(2, stoi(argv[++i]));
     }
 
-    MISState best = pop[0];
-    double best_time = 0.0;
-
-    cout << best.size << " " << 0.0 << endl;
-
-    // =======================
-    // Loop principal GA
-    // =======================
-    while(true){
-        double t = now_seconds() - t0;
-        if(t >= Tlimit) break;
-
-        // Selección de padres
-	int p1 = tournament(pop);
-	int p2 = tournament(pop);
-
-	// Cruce
-	MISState child = crossover(pop[p1], pop[p2]);
-
-	// Mutación simple
-	int v = rand() % G.n;
-	if(child.inS[v]) child.remove(v);
-	else if(child.conf[v]==0) child.add(v);
-
-	child.repair_and_complete();
-
-
-        // Intensificación solo para top-k
-	static long long iter = 0;
-iter++;
-
-// aplicar LS cada ls_freq iteraciones
-bool apply_ls = (ls_budget > 0) && (ls_freq > 0) && (iter % ls_freq == 0);
-
-if(apply_ls){
-    // Umbral: estimar "top-k" sin ordenar: tomamos una muestra
-    int samples = min(pop_size, 10);
-    int thr = 0;
-    for(int s=0;s<samples;s++){
-        int idx = rand()%pop_size;
-        thr = max(thr, pop[idx].size);
+    if(!tel::enable("solver_MISP", stats, perf)){
+        cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
     }
-    // Si el hijo es al menos tan bueno como el mejor de una muestra,
-    // lo intensificamos (aprox top-k, barato)
-    if(child.size >= thr){
-        local_search(child, ls_budget);
-        child.repair_and_complete();
+    if(hugepages) huge::enable();
+    set_load_threads(load_threads);
+    if(!eval_batch.empty()){
+        batch.threads = threads;
+        batch.tmax = Tlimit;
+        return run_batch(eval_batch, batch);
     }
-}
 
+    GraphR G;
+    try{
+        if(!gen.empty()){
+            GenSpec gs = parse_gen_spec(gen);
+            G.n = gs.n;
+            G.adj = gnp_adjacency(gs, nullptr, mem_limit);
+        }
+        else if(!G.load(instance, mem_limit)){
+            cerr << "ERROR: No se pudo leer grafo: " << instance << "\n";
+            return 1;
+        }
+    }catch(const exception& e){
+        cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
 
-        if(child.size > best.size){
-            best = child;
-            best_time = now_seconds() - t0;
-            cout << best.size << " " << best_time << endl;
+    try{
+        // Hash, --best_known, --cache, --init_sol, --reorder y cotas (pipeline.hpp)
+        PipelineOptions O;
+        O.tmax = Tlimit; O.target = target; O.seed = (unsigned)seed;
+        O.threads = threads; O.exact_max = exact_max;
+        O.reorder = reorder; O.width = width;
+        O.report_at = report_at; O.trace = trace;
+        O.init_sol = init_sol; O.best_known = best_known;
+        O.cache = cache_dir; O.out_sol = out_sol;
+        SolverPipeline<vector<char>> pipeline(O, AnytimeReporter::GENERAL);
+        pipeline.prepare(G.n, G.adj);
+
+        long long children = 0;
+        pipeline.start();
+        RunResult<vector<char>> R;
+        if(split){
+            LargeSolver solve_large = [&](const vector<vector<int>>& sub, double budget, unsigned s,
+                                          int comp_stop, const atomic<bool>* stop,
+                                          const function<void(int)>& on_improve){
+                GraphR Gc; Gc.n = (int)sub.size(); Gc.adj = sub;
+                GALSHooks Hc;
+                Hc.stop_flag = stop;
+                Hc.on_improve = [&](int v, double, const vector<char>&){ on_improve(v); };
+                return run_ga_ls(Gc, P, budget, s, comp_stop, Hc).best_sol;
+            };
+            R = pipeline.split(G.n, G.adj, solve_large);
+        } else {
+            GALSHooks H;
+            H.on_improve = [&](int best, double t, const vector<char>& s){ pipeline.improve(best, t, s, children); };
+            H.work = &children;
+            H.init_sol = move(pipeline.warm);
+            H.stop_flag = pipeline.stop_flag();
+            pipeline.children = &children;
+            // Ids y contadores de 16 bits si el grafo lo permite (index_width.hpp)
+            R = pipeline.with_width<GraphRT>(G, [&](const auto& Gw){
+                GALSResult r = run_ga_ls(Gw, P, Tlimit, (unsigned)seed, pipeline.stop_at, H);
+                return RunResult<vector<char>>{r.best_size, r.best_time, r.reached, move(r.best_sol)};
+            });
         }
 
-        // Reemplazo
-        int r = rand()%pop_size;
-        pop[r] = child;
+        // Salida final (con gap si hay --target)
+        return pipeline.finish(R);
+    }catch(const exception& e){
+        cerr << "ERROR: " << e.what() << "\n";
+        return 1;
     }
-
-    // Salida final
-    cout << best.size << " " << best_time << endl;
-    return 0;
 }
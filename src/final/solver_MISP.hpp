@@ -0,0 +1,331 @@
+// solver_MISP.hpp
+// Motor híbrido GA + LS (MH_p + MH_t) para MIS (namespace gals).
+// Lector, estado, operadores y el bucle run_ga_ls(). Lo usan build/solver_MISP
+// y los binarios que corren el GA+LS dentro del proceso.
+
+#pragma once
+#include <bits/stdc++.h>
+#include <stdlib.h>
+#include "../utils.hpp"
+#include "../telemetry.hpp"
+#include "../vertex_state.hpp"
+#include "../graph_load.hpp"
+
+namespace gals {
+using namespace std;
+
+// =======================
+// Generador con estado propio
+// Misma secuencia que srand(seed)/rand() de glibc (random_r con estado
+// TYPE_3 de 128 bytes), pero sin estado global: cada motor tiene el suyo
+// y puede correr en su propio hilo.
+// =======================
+struct RandR {
+    random_data data;
+    char state[128];
+
+    explicit RandR(unsigned s = 1){ seed(s); }
+    RandR(const RandR&) = delete;
+    RandR& operator=(const RandR&) = delete;
+
+    void seed(unsigned s){
+        memset(&data, 0, sizeof(data));
+        memset(state, 0, sizeof(state));
+        initstate_r(s, state, sizeof(state), &data);
+    }
+    int operator()(){
+        int32_t r;
+        random_r(&data, &r);
+        return (int)r;
+    }
+};
+
+// =======================
+// Lector robusto (DIMACS / n m / pares)
+// Normaliza a 0-based y deduplica
+// V: tipo de id de vértice en adj; C: tipo de los contadores conf de
+// MISStateT (ver index_width.hpp). GraphR = ints, como siempre.
+// =======================
+template <class V = int, class C = int>
+struct GraphRT {
+    using vertex_t = V;
+    using count_t = C;
+    int n = 0;
+    vector<vector<V>> adj;
+
+    static inline string trim(const string& s){
+        size_t a=0,b=s.size();
+        while(a<b && isspace((unsigned char)s[a])) ++a;
+        while(b>a && isspace((unsigned char)s[b-1])) --b;
+        return s.substr(a,b-a);
+    }
+
+    // Mismo formato que ga::Graph; dos pasadas sin copia cruda (graph_load.hpp)
+    bool load(const string &path, size_t mem_limit = 0) {
+        return load_adjacency(path, GraphDialect::GA, n, adj, nullptr, mem_limit);
+    }
+};
+using GraphR = GraphRT<>;
+
+
+// =======================
+// Estado MIS reutilizable
+// =======================
+template <class Gr>
+struct MISStateT {
+    const Gr* G;
+    PackedVertexState<typename Gr::count_t> vs;  // v ∈ S y conflictos (ver vertex_state.hpp)
+    int size;
+
+    MISStateT(const Gr* g=nullptr) { reset(g); }
+
+    void reset(const Gr* g){
+        G = g;
+        vs.assign(G->n);
+        size = 0;
+    }
+
+    bool in(int v) const { return vs.in(v); }
+
+    void add(int v){
+        size++;
+        vs.add(v, G->adj[v]);
+    }
+
+    void remove(int v){
+        size--;
+        vs.remove(v, G->adj[v]);
+    }
+
+    // Pertenencia 0/1 (best_sol y ganchos)
+    vector<char> membership() const { vector<char> m; vs.export_membership(m); return m; }
+
+    // Reparación + completar a maximal
+    void repair_and_complete(){
+        TEL_TIMED("gals.repair");
+        vector<int> deg(G->n);
+        for(int i=0;i<G->n;i++) deg[i] = G->adj[i].size();
+
+        bool changed = true;
+        while(changed){
+            changed = false;
+            for(int v=0;v<G->n;v++){
+                if(vs.in(v) && vs.conf(v)>0){
+                    remove(v);
+                    changed = true;
+                }
+            }
+        }
+        for(int v=0;v<G->n;v++){
+            if(vs.is_free(v)) add(v);
+        }
+    }
+};
+using MISState = MISStateT<GraphR>;
+
+// =======================
+// Greedy simple (init)
+// =======================
+template <class Gr>
+inline MISStateT<Gr> greedy_init(const Gr& G){
+    MISStateT<Gr> S(&G);
+    vector<int> order(G.n);
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(),
+         [&](int a,int b){ return G.adj[a].size() < G.adj[b].size(); });
+
+    for(int v : order){
+        if(S.vs.is_free(v)) S.add(v);
+    }
+    return S;
+}
+
+// =======================
+// Búsqueda Local (MH_t)
+// 1-exchange simple
+// =======================
+template <class St>
+inline void local_search(St& S, int budget, RandR& R){
+    TEL_TIMED("gals.local_search");
+    int n = S.G->n;
+    for(int it=0; it<budget; it++){
+        int v = R() % n;
+        // libre = fuera de S y sin vecinos en S: una lectura en vez de recorrer adj[v]
+        if(S.vs.is_free(v)) S.add(v);
+    }
+}
+
+
+// =======================
+// Selección por torneo
+// =======================
+template <class St>
+inline int tournament(const vector<St>& pop, RandR& R){
+    int a = R() % pop.size();
+    int b = R() % pop.size();
+    return (pop[a].size > pop[b].size) ? a : b;
+}
+
+// =======================
+// Cruce uniforme
+// =======================
+template <class St>
+inline St crossover(const St& A, const St& B, RandR& R){
+    St C(A.G);
+    for(int v=0; v<A.G->n; v++){
+        if(R() & 1){
+            if(A.in(v) && C.vs.is_free(v)) C.add(v);
+        }else{
+            if(B.in(v) && C.vs.is_free(v)) C.add(v);
+        }
+    }
+    C.repair_and_complete();
+    return C;
+}
+
+// =======================
+// Bucle GA + LS
+// =======================
+struct GALSParams {
+    int pop_size = 40;
+    int ls_budget = 200;
+    int ls_k = 4;        // reservado
+    int ls_freq = 10;
+};
+
+struct GALSResult {
+    int best_size = 0;
+    double best_time = 0.0;
+    vector<char> best_sol;
+    bool reached = false;   // alcanzó stop_at antes de tmax
+};
+
+// Ganchos opcionales para correr el GA+LS junto a otros motores
+struct GALSHooks {
+    function<void(int, double, const vector<char>&)> on_improve; // (best, t, sol)
+    const atomic<bool>* stop_flag = nullptr;                     // parada externa
+    // migrante: true y sol si hay un incumbente externo mejor que own_best
+    function<bool(int own_best, vector<char>& sol)> fetch_migrant;
+    long long* work = nullptr;   // si no es nulo: hijos generados (al día en on_improve)
+    vector<char> init_sol;       // --init_sol / --best_known: reemplaza al individuo 0
+};
+
+template <class Gr>
+inline GALSResult run_ga_ls(const Gr& G, const GALSParams& P, double Tlimit, unsigned seed,
+                            int stop_at = INT_MAX, const GALSHooks& H = {}){
+    RandR R(seed);
+    const int pop_size = P.pop_size;
+    const int ls_budget = P.ls_budget;
+    const int ls_freq = P.ls_freq;
+    auto stopped = [&]{ return H.stop_flag && H.stop_flag->load(memory_order_relaxed); };
+
+    double t0 = now_seconds();
+
+    // =======================
+    // Inicialización población
+    // =======================
+    TEL_PHASE("init");
+    vector<MISStateT<Gr>> pop;
+    for(int i=0;i<pop_size;i++){
+        // Con la parada levantada (deadline.hpp) se completa con copias en
+        // vez de seguir construyendo greedys
+        if(i > 0 && stopped()){ pop.push_back(pop[0]); continue; }
+        pop.push_back(greedy_init(G));
+    }
+
+    // Solución previa (reparada como un migrante)
+    if(!H.init_sol.empty()){
+        MISStateT<Gr> M(&G);
+        for(int v=0; v<G.n; v++) if(H.init_sol[v] && M.vs.is_free(v)) M.add(v);
+        M.repair_and_complete();
+        pop[0] = M;
+    }
+
+    MISStateT<Gr> best = pop[0];
+    for(int i=1;i<pop_size;i++) if(pop[i].size > best.size) best = pop[i];
+    double best_time = 0.0;
+
+    if (H.on_improve) H.on_improve(best.size, 0.0, best.membership());
+    bool reached = (best.size >= stop_at);
+    long long iter = 0;
+    vector<char> migrant;
+
+    // =======================
+    // Loop principal GA
+    // =======================
+    TEL_PHASE("main_loop");
+    while(!reached && !stopped()){
+        // El flag se lee en cada iteración; el reloj, cada 16 como respaldo
+        if((iter & 15) == 0 && now_seconds() - t0 >= Tlimit) break;
+        TEL_COUNT("gals.iterations", 1);
+        if (H.work) ++*H.work;
+
+        // Migrante externo: reemplaza a un individuo al azar
+        if(H.fetch_migrant && H.fetch_migrant(best.size, migrant)){
+            MISStateT<Gr> M(&G);
+            for(int v=0; v<G.n; v++) if(migrant[v] && M.vs.is_free(v)) M.add(v);
+            M.repair_and_complete();
+            if(M.size > best.size) best = M;
+            pop[R() % pop_size] = M;
+            TEL_COUNT("gals.migrants", 1);
+        }
+
+        // Selección de padres
+        int p1 = tournament(pop, R);
+        int p2 = tournament(pop, R);
+
+        // Cruce
+        MISStateT<Gr> child = crossover(pop[p1], pop[p2], R);
+        TEL_COUNT("gals.crossover", 1);
+
+        // Mutación simple
+        int v = R() % G.n;
+        if(child.in(v)) child.remove(v);
+        else if(child.vs.is_free(v)) child.add(v);
+        TEL_COUNT("gals.mutation", 1);
+
+        child.repair_and_complete();
+
+        // Intensificación solo para top-k
+        iter++;
+
+        // aplicar LS cada ls_freq iteraciones
+        bool apply_ls = (ls_budget > 0) && (ls_freq > 0) && (iter % ls_freq == 0);
+
+        if(apply_ls){
+            // Umbral: estimar "top-k" sin ordenar: tomamos una muestra
+            int samples = min(pop_size, 10);
+            int thr = 0;
+            for(int s=0;s<samples;s++){
+                int idx = R()%pop_size;
+                thr = max(thr, pop[idx].size);
+            }
+            // Si el hijo es al menos tan bueno como el mejor de una muestra,
+            // lo intensificamos (aprox top-k, barato)
+            if(child.size >= thr){
+                local_search(child, ls_budget, R);
+                child.repair_and_complete();
+            }
+        }
+
+        if(child.size > best.size){
+            best = child;
+            best_time = now_seconds() - t0;
+            if (H.on_improve) H.on_improve(best.size, best_time, best.membership());
+            if(best.size >= stop_at) reached = true;
+        }
+
+        // Reemplazo
+        int r = R()%pop_size;
+        pop[r] = child;
+    }
+
+    GALSResult res;
+    res.best_size = best.size;
+    res.best_time = best_time;
+    res.best_sol = best.membership();
+    res.reached = reached;
+    return res;
+}
+
+} // namespace gals
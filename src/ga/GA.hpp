@@ -0,0 +1,430 @@
+// GA.hpp - motor del Algoritmo Genético para MIS (namespace ga)
+// Lector, estado MIS, operadores y el bucle evolutivo run_ga(). Lo usan
+// build/GA (GA.cpp) y los binarios que corren el GA dentro del proceso.
+#pragma once
+#include <bits/stdc++.h>
+#include "../telemetry.hpp"
+#include "../vertex_state.hpp"
+#include "../graph_load.hpp"
+
+namespace ga {
+using namespace std;
+
+// ====== Utilidades de tiempo ======
+struct Timer {
+    chrono::steady_clock::time_point st;
+    Timer() : st(chrono::steady_clock::now()) {}
+    double elapsed() const {
+        using namespace chrono;
+        return duration_cast<duration<double>>(steady_clock::now() - st).count();
+    }
+};
+
+// ====== Lector de grafos ======
+// Soporta (a) DIMACS: "p edge n m" / "p edges n m" + "e u v" (1-indexed)
+//         (b) Texto simple: primera línea "n m", luego m líneas "u v" (1-indexed)
+// V: tipo de id de vértice en adj; C: tipo de los contadores conf de MISStateT
+// (ver index_width.hpp). Graph = ints, como siempre.
+template <class V = int, class C = int>
+struct GraphT {
+    using vertex_t = V;
+    using count_t = C;
+    int n = 0;
+    vector<vector<V>> adj;
+
+    static inline string trim(const string& s){
+        size_t a=0,b=s.size();
+        while(a<b && isspace((unsigned char)s[a])) ++a;
+        while(b>a && isspace((unsigned char)s[b-1])) --b;
+        return s.substr(a,b-a);
+    }
+
+    // Formatos "n", "n m" o DIMACS; dos pasadas sin copia cruda (graph_load.hpp)
+    bool load(const string &path, size_t mem_limit = 0) {
+        return load_adjacency(path, GraphDialect::GA, n, adj, nullptr, mem_limit);
+    }
+};
+using Graph = GraphT<>;
+
+
+// ====== Estado MIS (pertenencia+conf empaquetados, ver vertex_state.hpp) ======
+template <class Gr>
+struct MISStateT {
+    const Gr* G = nullptr;
+    PackedVertexState<typename Gr::count_t> vs;  // v ∈ S y # vecinos dentro de S
+
+    MISStateT(const Gr* g=nullptr){ reset(g); }
+    void reset(const Gr* g){
+        G = g;
+        if (!g) return;
+        vs.assign(g->n);
+    }
+    inline bool in(int v) const { return vs.in(v); }
+    inline void add_vertex(int v){
+        if (vs.in(v)) return;
+        vs.add(v, G->adj[v]);
+    }
+    inline void remove_vertex(int v){
+        if (!vs.in(v)) return;
+        vs.remove(v, G->adj[v]);
+    }
+    // Carga la pertenencia de un individuo (sin reparar)
+    template <class Vec>
+    void load(const Vec& inS){ vs.import_membership(inS, G->adj); }
+    // completa a maximal local usando cola sobre frontera
+    void complete_to_maximal_local(const vector<int> &frontier){
+        deque<int> q(frontier.begin(), frontier.end());
+        vector<uint8_t> inq(G->n,0);
+        for(int x: q) if (x>=0 && x<G->n) inq[x]=1;
+
+        while(!q.empty()){
+            int x=q.front(); q.pop_front(); inq[x]=0;
+            if (vs.is_free(x)){
+                add_vertex(x);
+                for(int w: G->adj[x]) if(!inq[w]){ q.push_back(w); inq[w]=1; }
+            }
+        }
+    }
+    // completa globalmente
+    void complete_global(){
+        vector<int> frontier(G->n);
+        iota(frontier.begin(), frontier.end(), 0);
+        complete_to_maximal_local(frontier);
+    }
+    int size() const { return vs.count_in(); }
+
+    // reparación dirigida: quita vértices con conflictos priorizando mayor (conf, degree)
+    void repair_and_complete(){
+        TEL_TIMED("ga.repair");
+        vector<int> deg(G->n);
+        for(int v=0; v<G->n; ++v) deg[v] = (int)G->adj[v].size();
+
+        // Mientras exista conflicto, eliminar el vértice más "caro"
+        int conflicted_cnt = 0;
+        for(int v=0; v<G->n; ++v) if(vs.in(v) && vs.conf(v)>0) conflicted_cnt++;
+
+        while(conflicted_cnt>0){
+            int worst = -1, wc=-1, wd=-1;
+            for(int v=0; v<G->n; ++v){
+                if(vs.in(v) && vs.conf(v)>0){
+                    int c = vs.conf(v), d = deg[v];
+                    if (c>wc || (c==wc && d>wd)){
+                        wc=c; wd=d; worst=v;
+                    }
+                }
+            }
+            // quitar "worst" y actualizar contador
+            if (worst==-1) break;
+            remove_vertex(worst);
+            // recomputar conflicted_cnt incrementalmente (barato)
+            conflicted_cnt = 0;
+            for(int v=0; v<G->n; ++v) if(vs.in(v) && vs.conf(v)>0) conflicted_cnt++;
+        }
+        complete_global();
+    }
+};
+using MISState = MISStateT<Graph>;
+
+// ====== Aleatorio ======
+inline thread_local std::mt19937 rng;
+inline int rnd_int(int a, int b){ std::uniform_int_distribution<int> d(a,b); return d(rng); }
+inline double rnd01(){ std::uniform_real_distribution<double> d(0.0,1.0); return d(rng); }
+
+// ====== Individuo ======
+struct Individual {
+    huge::vector<uint8_t> inS;   // genoma; con --hugepages, en la arena de 2 MB
+    int fit = 0;
+};
+
+// construye MIS factible por greedy determinista (grado ascendente)
+template <class Gr>
+inline MISStateT<Gr> greedy_deterministic(const Gr& G){
+    MISStateT<Gr> st(&G);
+    vector<int> order(G.n);
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&](int a,int b){ return G.adj[a].size() < G.adj[b].size(); });
+    for(int v: order){
+        if (st.vs.is_free(v)) st.add_vertex(v);
+        // micro-completación de vecinos de grado bajo (<=3)
+        for(int u: G.adj[v]) if ((int)G.adj[u].size()<=3 && st.vs.is_free(u)) st.add_vertex(u);
+    }
+    return st;
+}
+
+// greedy aleatorizado RCL-α (α en [0,1]). Cada paso recorre los n vértices
+// (O(n²) en total): con la parada levantada se corta y se completa a maximal
+template <class Gr>
+inline MISStateT<Gr> greedy_alpha(const Gr& G, double alpha, const atomic<bool>* stop = nullptr){
+    MISStateT<Gr> st(&G);
+    vector<uint8_t> alive(G.n,1);
+    vector<int> deg(G.n);
+    for(int i=0;i<G.n;i++) deg[i]=G.adj[i].size();
+    int vivos = G.n;
+
+    while(vivos>0){
+        if (stop && stop->load(memory_order_relaxed)) break;
+        int dmin=INT_MAX, dmax=-1;
+        for(int u=0;u<G.n;u++) if(alive[u]){ dmin=min(dmin, deg[u]); dmax=max(dmax, deg[u]); }
+        if (dmin==INT_MAX) break;
+        double thr = dmin + alpha * (dmax - dmin);
+        vector<int> RCL; RCL.reserve(G.n);
+        int thr_int = (int)floor(thr+1e-9);
+        for(int u=0;u<G.n;u++) if(alive[u] && deg[u] <= thr_int) RCL.push_back(u);
+        if (RCL.empty()) { for(int u=0;u<G.n;u++) if(alive[u]) { RCL.push_back(u); break; } }
+
+        int u = RCL[rnd_int(0,(int)RCL.size()-1)];
+        if (st.vs.is_free(u)) st.add_vertex(u);
+
+        // eliminar u y sus vecinos del conjunto "alive"
+        vector<int> Elim = {u};
+        for(int v: G.adj[u]) if(alive[v]) Elim.push_back(v);
+        for(int r: Elim) if(alive[r]){
+            alive[r]=0; --vivos;
+            for(int w: G.adj[r]) if(alive[w]) deg[w]--;
+        }
+    }
+    st.complete_global();
+    return st;
+}
+
+// inicialización de población
+struct GAParams {
+    int pop = 80;
+    double pc = 0.9;
+    double pm = 0.03;
+    int elitism = 2;
+    int stall_gen = 100;
+    string init = "mix";         // mix | greedy | random
+    string repair = "frontier";  // placeholder
+    bool ls = true;
+};
+
+template <class St>
+inline Individual toIndividual(const St& st){
+    Individual I; st.vs.export_membership(I.inS); I.fit = st.size(); return I;
+}
+
+template <class Gr>
+inline vector<Individual> init_population(const Gr& G, int pop, const string& init_mode,
+                                         const atomic<bool>* stop = nullptr){
+    vector<Individual> P; P.reserve(pop);
+    if (init_mode=="greedy" || init_mode=="mix"){
+        auto gd = greedy_deterministic(G); P.push_back(toIndividual(gd));
+    }
+    while ((int)P.size() < pop){
+        // En grafos grandes armar la población puede pasar de -t: con la
+        // parada levantada se sigue con los individuos que haya
+        if (!P.empty() && stop && stop->load(memory_order_relaxed)) break;
+        int mode = 0;
+        if (init_mode=="mix") mode = rnd_int(0,1); // 0: alpha, 1: random
+        else if (init_mode=="greedy") mode = 0;
+        else mode = 1; // random
+
+        MISStateT<Gr> st(&G);
+        if (mode==0){
+            double a = 0.1 + 0.2*rnd01(); // alpha en [0.1,0.3]
+            st = greedy_alpha(G, a, stop);
+        } else {
+            // random factible + completar
+            st.reset(&G);
+            vector<int> perm(G.n); iota(perm.begin(), perm.end(), 0);
+            shuffle(perm.begin(), perm.end(), rng);
+            for(int v: perm) if (st.vs.is_free(v) && rnd01()<0.5) st.add_vertex(v);
+            st.complete_global();
+        }
+        P.push_back(toIndividual(st));
+    }
+    return P;
+}
+
+// torneo binario
+inline int select_tournament(const vector<Individual>& P){
+    int a = rnd_int(0,(int)P.size()-1);
+    int b = rnd_int(0,(int)P.size()-1);
+    return (P[a].fit >= P[b].fit)? a : b;
+}
+
+// cruce 1: unión + repair
+template <class Gr>
+inline Individual crossover_union_repair(const Gr& G, const Individual& A, const Individual& B){
+    MISStateT<Gr> st(&G);
+    for(int v=0; v<G.n; ++v) if (A.inS[v] || B.inS[v]) st.add_vertex(v);
+    st.repair_and_complete();
+    return toIndividual(st);
+}
+
+// cruce 2: intersección + sesgo a grados bajos
+template <class Gr>
+inline Individual crossover_intersection_biased(const Gr& G, const Individual& A, const Individual& B){
+    MISStateT<Gr> st(&G);
+    vector<int> frontier; frontier.reserve(G.n);
+
+    for(int v=0; v<G.n; ++v){
+        if (A.inS[v] && B.inS[v]) st.add_vertex(v);
+    }
+    vector<int> cand;
+    cand.reserve(G.n);
+    for(int v=0; v<G.n; ++v) if (A.inS[v]^B.inS[v]) cand.push_back(v);
+    sort(cand.begin(), cand.end(), [&](int a,int b){ return G.adj[a].size() < G.adj[b].size(); });
+
+    for(int v: cand){
+        if (st.vs.is_free(v)) {
+            st.add_vertex(v);
+            for(int u: G.adj[v]) frontier.push_back(u);
+        }
+    }
+    st.complete_to_maximal_local(frontier);
+    return toIndividual(st);
+}
+
+// mutación suave
+template <class Gr>
+inline void mutate_soft(const Gr& G, Individual& I, double pm){
+    if (pm <= 0.0) return;
+    MISStateT<Gr> st(&G); st.load(I.inS);
+
+    int trials = max(1, (int)round(pm * G.n));
+    while(trials--){
+        int v = rnd_int(0, G.n-1);
+        if (st.vs.is_free(v)){
+            st.add_vertex(v);
+        } else if (st.in(v) && rnd01()<0.2){
+            st.remove_vertex(v);
+        }
+    }
+    st.complete_global();
+    st.vs.export_membership(I.inS);
+    I.fit = st.size();
+}
+
+// mejora local 1-improvement
+template <class Gr>
+inline void local_search_1impr(const Gr& G, Individual& I){
+    TEL_TIMED("ga.local_search");
+    MISStateT<Gr> st(&G); st.load(I.inS);
+    vector<int> freeNodes; freeNodes.reserve(G.n);
+    for(int v=0; v<G.n; ++v) if(st.vs.is_free(v)) freeNodes.push_back(v);
+    st.complete_to_maximal_local(freeNodes);
+    st.vs.export_membership(I.inS);
+    I.fit = st.size();
+}
+
+// ====== Bucle evolutivo ======
+struct GAResult {
+    int best_fit = 0;
+    double best_time = 0.0;
+    vector<uint8_t> best_sol;
+    bool reached = false;   // alcanzó stop_at antes de tmax
+};
+
+// Ganchos opcionales para correr el GA junto a otros motores
+struct GAHooks {
+    function<void(int, double, const vector<uint8_t>&)> on_improve; // (best, t, sol)
+    const atomic<bool>* stop_flag = nullptr;                        // parada externa
+    // migrante: true y sol si hay un incumbente externo mejor que own_best
+    function<bool(int own_best, vector<uint8_t>& sol)> fetch_migrant;
+    long long* work = nullptr;   // si no es nulo: hijos generados (al día en on_improve)
+    vector<uint8_t> init_sol;    // --init_sol / --best_known: entra como élite en la población inicial
+};
+
+// Individuo a partir de una solución externa (se repara si no es independiente)
+template <class Gr>
+inline Individual from_solution(const Gr& G, const vector<uint8_t>& sol){
+    MISStateT<Gr> st(&G);
+    for(int v=0; v<G.n; ++v) if (sol[v] && st.vs.is_free(v)) st.add_vertex(v);
+    st.complete_global();
+    return toIndividual(st);
+}
+
+template <class Gr>
+inline GAResult run_ga(const Gr& G, const GAParams& P, double tmax, unsigned seed,
+                       int stop_at = INT_MAX, const GAHooks& H = {}){
+    rng.seed(seed);
+    auto stopped = [&]{ return H.stop_flag && H.stop_flag->load(memory_order_relaxed); };
+
+    // Inicialización
+    Timer timer;
+    TEL_PHASE("init");
+    auto Pop = init_population(G, P.pop, P.init, H.stop_flag);
+    // Solución previa: reemplaza al peor; el elitismo la conserva mientras sea de las mejores
+    if (!H.init_sol.empty()){
+        int worst = 0;
+        for(int i=1;i<(int)Pop.size();++i) if(Pop[i].fit < Pop[worst].fit) worst=i;
+        Pop[worst] = from_solution(G, H.init_sol);
+    }
+
+    GAResult R;
+    int best_idx = 0;
+    for(int i=1;i<(int)Pop.size();++i) if(Pop[i].fit > Pop[best_idx].fit) best_idx=i;
+    R.best_fit = Pop[best_idx].fit;
+    R.best_time = timer.elapsed();
+    R.best_sol.assign(Pop[best_idx].inS.begin(), Pop[best_idx].inS.end());
+    if (H.on_improve) H.on_improve(R.best_fit, R.best_time, R.best_sol);
+
+    int stall = 0;
+    R.reached = (R.best_fit >= stop_at);
+    vector<uint8_t> migrant;
+
+    // Bucle evolutivo
+    TEL_PHASE("main_loop");
+    while (!R.reached && !stopped() && timer.elapsed() < tmax){
+        TEL_COUNT("ga.generations", 1);
+        // migrante externo: reemplaza al peor individuo
+        if (H.fetch_migrant && H.fetch_migrant(R.best_fit, migrant)){
+            int worst = 0;
+            for(int i=1;i<(int)Pop.size();++i) if(Pop[i].fit < Pop[worst].fit) worst=i;
+            Pop[worst] = from_solution(G, migrant);
+            TEL_COUNT("ga.migrants", 1);
+            if (Pop[worst].fit > R.best_fit){
+                R.best_fit = Pop[worst].fit;
+                R.best_sol.assign(Pop[worst].inS.begin(), Pop[worst].inS.end());
+            }
+        }
+
+        // nueva población con elitismo
+        vector<Individual> next; next.reserve(P.pop);
+        vector<int> idx(Pop.size()); iota(idx.begin(), idx.end(), 0);
+        sort(idx.begin(), idx.end(), [&](int a,int b){ return Pop[a].fit > Pop[b].fit; });
+        for(int e=0;e<min(P.elitism,(int)Pop.size());++e) next.push_back(Pop[idx[e]]);
+
+        // rellenar
+        while ((int)next.size() < P.pop){
+            const Individual& A = Pop[select_tournament(Pop)];
+            const Individual& B = Pop[select_tournament(Pop)];
+            Individual Cc;
+
+            if (rnd01() < P.pc) {
+                if (rnd01() < 0.5){ Cc = crossover_union_repair(G, A, B); TEL_COUNT("ga.crossover_union", 1); }
+                else              { Cc = crossover_intersection_biased(G, A, B); TEL_COUNT("ga.crossover_intersection", 1); }
+            } else {
+                Cc = (A.fit >= B.fit) ? A : B; // copiar mejor padre
+                TEL_COUNT("ga.copy_parent", 1);
+            }
+            if (rnd01() < P.pm){ mutate_soft(G, Cc, P.pm); TEL_COUNT("ga.mutation", 1); }
+            if (P.ls) local_search_1impr(G, Cc);
+
+            next.push_back(move(Cc));
+            TEL_COUNT("ga.children", 1);
+            if (H.work) ++*H.work;
+
+            // any-time
+            const Individual& last = next.back();
+            if (last.fit > R.best_fit){
+                R.best_fit = last.fit;
+                R.best_time = timer.elapsed();
+                R.best_sol.assign(last.inS.begin(), last.inS.end());
+                if (H.on_improve) H.on_improve(R.best_fit, R.best_time, R.best_sol);
+                stall = 0;
+                if (R.best_fit >= stop_at){ R.reached = true; break; }
+            }
+            if (stopped()) break;
+        }
+        Pop.swap(next);
+        stall++;
+        if (stall >= P.stall_gen) stall = 0;
+        if (timer.elapsed() >= tmax) break;
+    }
+    return R;
+}
+
+} // namespace ga
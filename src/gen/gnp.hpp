@@ -0,0 +1,113 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+#include "../graph_load.hpp"
+
+/**
+ * Generador Erdős–Rényi G(n, p) determinista en O(n + m).
+ * Muestreo por saltos geométricos (Batagelj & Brandes 2005): en vez de
+ * sortear cada uno de los n(n-1)/2 pares, se salta directamente al siguiente
+ * par presente con un salto ~ Geom(p).
+ *
+ * Determinismo: el RNG es splitmix64 y la conversión a double se hace a mano
+ * (las distribuciones de <random> dependen de la implementación), así que la
+ * misma (n, p, seed) da el mismo grafo en cualquier plataforma.
+ *
+ * Las aristas salen como pares (v, w) con w < v, en orden creciente de v y
+ * luego de w; las listas de adyacencia resultan ordenadas y sin duplicados.
+ */
+struct GenSpec {
+    int n = 0;
+    double p = 0.0;
+    uint64_t seed = 1;
+};
+
+// "n,p,seed" (seed opcional); lanza std::runtime_error si es inválido
+inline GenSpec parse_gen_spec(const std::string& s) {
+    GenSpec g;
+    std::stringstream ss(s);
+    std::string tok;
+    std::vector<std::string> parts;
+    while (std::getline(ss, tok, ',')) parts.push_back(tok);
+    if (parts.size() < 2 || parts.size() > 3)
+        throw std::runtime_error("--gen espera n,p[,seed]: " + s);
+    try {
+        g.n = std::stoi(parts[0]);
+        g.p = std::stod(parts[1]);
+        if (parts.size() == 3) g.seed = std::stoull(parts[2]);
+    } catch (const std::exception&) {
+        throw std::runtime_error("--gen espera n,p[,seed]: " + s);
+    }
+    if (g.n <= 0 || g.p < 0.0 || g.p > 1.0)
+        throw std::runtime_error("--gen fuera de rango (n > 0, 0 <= p <= 1): " + s);
+    return g;
+}
+
+struct SplitMix64 {
+    uint64_t x;
+    explicit SplitMix64(uint64_t seed) : x(seed) {}
+    uint64_t next() {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+    // Uniforme en [0, 1) con 53 bits
+    double uniform() { return (double)(next() >> 11) * 0x1.0p-53; }
+};
+
+// Llama emit(v, w) por cada arista (w < v)
+template <class Emit>
+inline void gnp_for_each_edge(const GenSpec& g, Emit emit) {
+    const long long n = g.n;
+    if (n < 2 || g.p <= 0.0) return;
+    if (g.p >= 1.0) {
+        for (long long v = 1; v < n; ++v)
+            for (long long w = 0; w < v; ++w) emit((int)v, (int)w);
+        return;
+    }
+    SplitMix64 rng(g.seed);
+    const double lq = std::log(1.0 - g.p);
+    long long v = 1, w = -1;
+    while (v < n) {
+        double skip = std::floor(std::log(1.0 - rng.uniform()) / lq);
+        // Un salto mayor que los pares restantes termina el grafo
+        if (skip > (double)n * (double)n) break;
+        w += 1 + (long long)skip;
+        while (w >= v && v < n) { w -= v; ++v; }
+        if (v < n) emit((int)v, (int)w);
+    }
+}
+
+// Listas de adyacencia 0-based; m_out (opcional) recibe el número de aristas.
+// Dos pasadas del generador (es determinista): la primera cuenta los grados y
+// la segunda llena listas reservadas a la medida, así el pico es el grafo
+// final. Lanza std::runtime_error si supera mem_limit (bytes, 0 = sin límite).
+inline std::vector<std::vector<int>> gnp_adjacency(const GenSpec& g, long long* m_out = nullptr,
+                                                   size_t mem_limit = 0) {
+    std::vector<uint32_t> deg(g.n, 0);
+    long long m = 0;
+    gnp_for_each_edge(g, [&](int v, int w) { ++deg[v]; ++deg[w]; ++m; });
+    check_mem_limit(adjacency_bytes(g.n, 2 * m), mem_limit, "el G(n,p)");
+    std::vector<std::vector<int>> adj(g.n);
+    for (int v = 0; v < g.n; ++v) adj[v].reserve(deg[v]);
+    deg = std::vector<uint32_t>();
+    gnp_for_each_edge(g, [&](int v, int w) {
+        adj[v].push_back(w);
+        adj[w].push_back(v);
+    });
+    if (m_out) *m_out = m;
+    return adj;
+}
+
+// Nombre al estilo del dataset: erdos_n<n>_p0c<p>_<seed>.graph
+inline std::string gnp_name(const GenSpec& g) {
+    std::ostringstream os;
+    os << "erdos_n" << g.n << "_p0c" << g.p << "_" << g.seed << ".graph";
+    return os.str();
+}
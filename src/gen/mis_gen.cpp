@@ -0,0 +1,146 @@
+// mis_gen.cpp
+// Generador de instancias G(n, p) sin red ni dataset externo (ver gnp.hpp).
+//
+// Uso (CLI):
+//   ./build/mis-gen -n <n> -p <p> [--seed s] [-o salida.graph]
+//   ./build/mis-gen --grid <dir> [--sizes 1000,2000,3000] [--ps 0.05,0.1,...]
+//                   [--seeds 1,2,3]
+//
+// - Sin -o escribe en stdout. Formato: primera línea n, luego "u v" 0-based.
+// - --grid escribe <dir>/erdos_n<n>_p0c<p>_<seed>.graph para cada combinación
+//   (mismos nombres que el dataset de scripts/get_dataset.sh).
+// - stderr: "#gen: n=.. p=.. seed=.. m=.. time=.." por grafo.
+// - --stats json: línea JSON en stderr con tiempos, aristas escritas y memoria.
+// Los solvers aceptan además --gen n,p,seed para generar en memoria.
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <sys/stat.h>
+#include "gnp.hpp"
+#include "../utils.hpp"
+#include "../telemetry.hpp"
+
+TEL_DEFINE_ALLOC_HOOKS()
+
+// Escritura con buffer propio: el volcado de texto domina el tiempo total
+class EdgeWriter {
+public:
+    explicit EdgeWriter(FILE* f) : f(f) { buf.reserve(1 << 20); }
+    ~EdgeWriter() { flush(); }
+    void put_int(long long x) {
+        char tmp[24];
+        int k = 0;
+        do { tmp[k++] = char('0' + x % 10); x /= 10; } while (x);
+        while (k) buf.push_back(tmp[--k]);
+    }
+    void put_char(char c) {
+        buf.push_back(c);
+        if (buf.size() >= (1 << 20)) flush();
+    }
+    void flush() {
+        if (!buf.empty()) fwrite(buf.data(), 1, buf.size(), f);
+        buf.clear();
+    }
+private:
+    FILE* f;
+    std::vector<char> buf;
+};
+
+static long long write_graph(const GenSpec& g, FILE* f) {
+    EdgeWriter out(f);
+    out.put_int(g.n);
+    out.put_char('\n');
+    long long m = 0;
+    gnp_for_each_edge(g, [&](int v, int w) {
+        out.put_int(w);
+        out.put_char(' ');
+        out.put_int(v);
+        out.put_char('\n');
+        ++m;
+    });
+    return m;
+}
+
+static bool generate_to(const GenSpec& g, const std::string& path) {
+    double t0 = now_seconds();
+    FILE* f = path.empty() ? stdout : fopen(path.c_str(), "wb");
+    if (!f) {
+        std::cerr << "No se pudo abrir para escritura: " << path << "\n";
+        return false;
+    }
+    long long m = write_graph(g, f);
+    if (f != stdout) fclose(f);
+    else fflush(stdout);
+    TEL_COUNT("gen.graphs", 1);
+    TEL_COUNT("gen.edges", m);
+    std::cerr << "#gen: n=" << g.n << " p=" << g.p << " seed=" << g.seed
+              << " m=" << m << " time=" << std::fixed << std::setprecision(6)
+              << (now_seconds() - t0) << "\n";
+    return true;
+}
+
+template <class T>
+static std::vector<T> parse_list(const std::string& s) {
+    std::vector<T> v;
+    std::stringstream ss(s);
+    std::string tok;
+    while (std::getline(ss, tok, ',')) {
+        std::stringstream ts(tok);
+        T x;
+        if (ts >> x) v.push_back(x);
+    }
+    return v;
+}
+
+int main(int argc, char** argv) {
+    GenSpec g;
+    std::string out_path, grid_dir, stats;
+    std::vector<int> sizes = {1000, 2000, 3000};
+    std::vector<double> ps = {0.05, 0.1, 0.15, 0.2, 0.25, 0.3, 0.35, 0.4, 0.45,
+                              0.5, 0.55, 0.6, 0.65, 0.7, 0.75, 0.8, 0.85, 0.9, 0.95};
+    std::vector<unsigned long long> seeds = {1};
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) g.n = std::stoi(argv[++i]);
+        else if (a == "-p" && i + 1 < argc) g.p = std::stod(argv[++i]);
+        else if (a == "--seed" && i + 1 < argc) g.seed = std::stoull(argv[++i]);
+        else if (a == "-o" && i + 1 < argc) out_path = argv[++i];
+        else if (a == "--grid" && i + 1 < argc) grid_dir = argv[++i];
+        else if (a == "--sizes" && i + 1 < argc) sizes = parse_list<int>(argv[++i]);
+        else if (a == "--ps" && i + 1 < argc) ps = parse_list<double>(argv[++i]);
+        else if (a == "--seeds" && i + 1 < argc) seeds = parse_list<unsigned long long>(argv[++i]);
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
+        else {
+            std::cerr << "Unknown or incomplete arg: " << a << "\n";
+            return 1;
+        }
+    }
+    if (!tel::enable("mis-gen", stats)) {
+        std::cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+    TEL_PHASE("main_loop");
+
+    if (!grid_dir.empty()) {
+        mkdir(grid_dir.c_str(), 0755);
+        for (int n : sizes) for (double p : ps) for (auto s : seeds) {
+            GenSpec gi;
+            gi.n = n; gi.p = p; gi.seed = s;
+            if (!generate_to(gi, grid_dir + "/" + gnp_name(gi))) return 2;
+        }
+        return 0;
+    }
+
+    if (g.n <= 0 || g.p < 0.0 || g.p > 1.0) {
+        std::cerr << "Uso: mis-gen -n <n> -p <p> [--seed s] [-o salida.graph]\n"
+                  << "     mis-gen --grid <dir> [--sizes a,b,..] [--ps p1,p2,..] [--seeds s1,..]\n"
+                  << "     (ambos aceptan --stats json)\n";
+        return 1;
+    }
+    return generate_to(g, out_path) ? 0 : 2;
+}
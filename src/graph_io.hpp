@@ -3,6 +3,7 @@
 #include <string>
 #include <fstream>
 #include <stdexcept>
+#include "graph_load.hpp"
 
 /**
  * Representación básica de grafo no dirigido con listas de adyacencia.
@@ -20,26 +21,14 @@ struct Graph {
  * Carga un grafo desde archivo .graph con el formato:
  *  1) Primera línea: n
  *  2) Resto: pares "u v" (0-based), una arista por línea
- * Ignora lazos (u==v) y valida rangos de índices.
- * Lanza std::runtime_error si hay problemas de lectura.
+ * Ignora lazos (u==v) y valida rangos de índices. Dos pasadas (contar y
+ * llenar) sin copia cruda de aristas (graph_load.hpp).
+ * Lanza std::runtime_error si hay problemas de lectura o si el grafo supera
+ * mem_limit (bytes, 0 = sin límite).
  */
-inline Graph load_graph(const std::string& path) {
-    std::ifstream in(path);
-    if (!in) throw std::runtime_error("No se pudo abrir: " + path);
-
+inline Graph load_graph(const std::string& path, size_t mem_limit = 0) {
     Graph G;
-    if (!(in >> G.n) || G.n <= 0)
-        throw std::runtime_error("Encabezado inválido en: " + path);
-
-    G.adj.assign(G.n, {});
-    long long u, v;
-    while (in >> u >> v) {
-        if (u == v) continue; // ignorar lazos
-        if (u < 0 || v < 0 || u >= G.n || v >= G.n)
-            throw std::runtime_error("Índice fuera de rango en: " + path);
-        G.adj[(int)u].push_back((int)v);
-        G.adj[(int)v].push_back((int)u);
-        ++G.m;
-    }
+    if (!load_adjacency(path, GraphDialect::Plain, G.n, G.adj, &G.m, mem_limit))
+        throw std::runtime_error("No se pudo abrir: " + path);
     return G;
 }
@@ -0,0 +1,701 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/**
+ * Carga de grafos en dos pasadas (contar y llenar), sin copia cruda de
+ * aristas. La usan load_graph (graph_io.hpp), sa::read_graph,
+ * ga::Graph::load, gals::GraphR::load y load_csr (csr.hpp).
+ *
+ * Antes cada lector guardaba todas las aristas en un vector<pair> y después
+ * las copiaba dos veces a las listas, que crecían a fuerza de push_back: el
+ * pico al cargar era ~3× el grafo final. Ahora:
+ *  1) una primera pasada por el archivo cuenta los grados (por id crudo) y
+ *     resuelve n y la base (0 o 1) según el dialecto;
+ *  2) con esos grados se reservan las listas justas (o el CSR) y una
+ *     segunda pasada las llena.
+ * El pico es el grafo final más un contador de 32 bits por vértice. Los ids
+ * llegan hasta INT_MAX (sa::read_graph descartaba los >= 10^6).
+ *
+ * Dialectos: la gramática de cada lector de siempre, sin cambios.
+ *  - Plain (load_graph): "n" y luego pares "u v" 0-based, como flujo de
+ *    enteros; un id fuera de rango es error; no deduplica.
+ *  - SA (sa::read_graph): comentarios c/#/%//, cabecera "p edge n m", líneas
+ *    "u v"; 1-based si aparece el 1 pero no el 0; deduplica.
+ *  - GA (ga::Graph, gals::GraphR): cabecera "n", "n m" o DIMACS ("p ..." y
+ *    líneas "e u v"); 0-based si aparece algún 0; deduplica.
+ *
+ * --mem_limit (parse_mem_limit): tras la primera pasada se estima el tamaño
+ * final y, si supera el límite, check_mem_limit aborta antes de reservar.
+ *
+ * --load_threads T (set_load_threads): con T > 1 y archivos de 1 MB o más,
+ * las dos pasadas corren en T hilos sobre el archivo mapeado (par_scan):
+ *  - los trozos se cortan en saltos de línea, y cada trozo lleva su propio
+ *    histograma de grados;
+ *  - la suma prefija de los histogramas da las filas y, para cada trozo, su
+ *    cursor dentro de cada fila; el llenado escribe sin atómicos y deja las
+ *    filas en el mismo orden que la pasada secuencial;
+ *  - el sort y el dedupe de las filas se reparten por rangos.
+ * El resultado es idéntico al secuencial. Si un trozo encuentra una línea
+ * que depende del estado (una cabecera a mitad de archivo, un par de Plain
+ * partido en dos líneas), se repite la carga en secuencial.
+ */
+enum class GraphDialect { Plain, SA, GA };
+
+// --load_threads: 0 = uno por núcleo, 1 = carga secuencial
+inline int& load_threads_option() { static int t = 0; return t; }
+inline void set_load_threads(int t) { load_threads_option() = t < 0 ? 0 : t; }
+inline int load_threads() {
+    if (load_threads_option() > 0) return load_threads_option();
+    const unsigned hc = std::thread::hardware_concurrency();
+    return hc ? (int)std::min(hc, 64u) : 1;
+}
+
+// --mem_limit: "512M", "8G", "4096" (sin sufijo = MB). 0 = sin límite.
+inline size_t parse_mem_limit(const std::string& s) {
+    char* end = nullptr;
+    const double x = std::strtod(s.c_str(), &end);
+    if (end == s.c_str() || x < 0) throw std::runtime_error("--mem_limit espera p.ej. 512M u 8G: " + s);
+    double mul = 1024.0 * 1024.0;
+    const std::string suf = end;
+    if (suf == "K" || suf == "k") mul = 1024.0;
+    else if (suf == "G" || suf == "g") mul = 1024.0 * 1024.0 * 1024.0;
+    else if (suf == "T" || suf == "t") mul = 1024.0 * 1024.0 * 1024.0 * 1024.0;
+    else if (!suf.empty() && suf != "M" && suf != "m")
+        throw std::runtime_error("--mem_limit espera p.ej. 512M u 8G: " + s);
+    return (size_t)(x * mul);
+}
+
+// Lanza std::runtime_error si need supera limit (0 = sin límite)
+inline void check_mem_limit(size_t need, size_t limit, const std::string& what) {
+    if (limit == 0 || need <= limit) return;
+    throw std::runtime_error("--mem_limit: " + what + " necesita ~" + std::to_string(need >> 20) +
+                             " MB y el límite es " + std::to_string(limit >> 20) + " MB");
+}
+
+// Bytes de n listas vector<int> con total ids en total (más la cabecera de malloc)
+inline size_t adjacency_bytes(long long n, long long total) {
+    return (size_t)n * (sizeof(std::vector<int>) + 16) + (size_t)total * sizeof(int);
+}
+
+namespace gload {
+
+// isspace del locale "C" (el único que usa el repo), sin llamada por carácter
+inline bool is_ws(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+inline const char* skip_ws(const char* p, const char* e) {
+    while (p < e && is_ws(*p)) ++p;
+    return p;
+}
+inline const char* skip_word(const char* p, const char* e) {
+    p = skip_ws(p, e);
+    while (p < e && !is_ws(*p)) ++p;
+    return p;
+}
+// Como "ss >> x" con long long: salta blancos; false si no hay número o desborda
+inline bool next_int(const char*& p, const char* e, long long& x) {
+    const char* q = skip_ws(p, e);
+    bool neg = false;
+    if (q < e && (*q == '+' || *q == '-')) neg = (*q++ == '-');
+    if (q >= e || (unsigned)(*q - '0') > 9) return false;
+    unsigned long long v = 0;
+    const char* fast = q + std::min<ptrdiff_t>(e - q, 18);   // 18 dígitos no desbordan
+    while (q < fast && (unsigned)(*q - '0') <= 9) v = v * 10 + (unsigned)(*q++ - '0');
+    while (q < e && (unsigned)(*q - '0') <= 9) {
+        const unsigned d = (unsigned)(*q++ - '0');
+        if (v > ((unsigned long long)LLONG_MAX - d) / 10) return false;
+        v = v * 10 + d;
+    }
+    x = neg ? -(long long)v : (long long)v;
+    p = q;
+    return true;
+}
+
+// Una pasada por el archivo: lo que se sabe de él y emit(u, v) por arista (ids crudos)
+struct EdgeScan {
+    bool opened = false;
+    long long declared_n = -1;     // cabecera (o primer entero en Plain)
+    long long max_id = LLONG_MIN;  // mayor id de arista visto
+    bool saw_zero = false, saw_one = false;
+    long long edges = 0;           // registros de arista
+    long long dropped = 0;         // SA: aristas con ids negativos o > INT_MAX
+};
+
+inline void note_edge(EdgeScan& S, long long u, long long v) {
+    ++S.edges;
+    S.max_id = std::max(S.max_id, std::max(u, v));
+    if (u == 0 || v == 0) S.saw_zero = true;
+    if (u == 1 || v == 1) S.saw_one = true;
+}
+
+/**
+ * Gramática de un dialecto, línea a línea. En modo body (los trozos de la
+ * carga en paralelo) no se aplican las líneas que cambiarían el estado: una
+ * cabecera tardía o un par de Plain partido entre dos líneas. Esas líneas
+ * marcan irregular, y la carga vuelve a la pasada secuencial.
+ */
+struct LineParser {
+    GraphDialect d = GraphDialect::Plain;
+    bool body = false;
+    bool irregular = false;
+    bool done = false;   // Plain: cabecera inválida o token no numérico (fin)
+    bool data = false;   // SA/GA: ya hubo una línea de aristas
+    bool in_dimacs = false, saw_header_n = false, saw_header_nm = false;
+    bool plain_header = false, have_u = false;
+    long long pu = 0;
+
+    // Desde aquí cada línea se interpreta sola: termina el prefijo secuencial
+    bool stable() const { return d == GraphDialect::Plain ? plain_header && !have_u : data; }
+
+    // [p, e): una línea (con o sin '\n'); edge(u, v) por arista
+    template <class Edge>
+    void line(const char* p, const char* e, EdgeScan& S, Edge& edge, const std::string& path) {
+        if (d == GraphDialect::Plain) {
+            // Flujo de enteros: "n" y pares, sin importar los saltos de línea
+            long long x;
+            for (;;) {
+                if (!next_int(p, e, x)) {
+                    if (skip_ws(p, e) != e) { done = true; irregular = body; }   // token no numérico: fin
+                    break;
+                }
+                if (!plain_header) {
+                    if (x <= 0) { done = true; break; }
+                    S.declared_n = x;
+                    plain_header = true;
+                } else if (!have_u) {
+                    pu = x;
+                    have_u = true;
+                } else {
+                    have_u = false;
+                    if (pu == x) continue;
+                    if (pu < 0 || x < 0 || pu >= S.declared_n || x >= S.declared_n)
+                        throw std::runtime_error("Índice fuera de rango en: " + path);
+                    edge(pu, x);
+                }
+            }
+            if (body && have_u) irregular = true;
+            return;
+        }
+        p = skip_ws(p, e);
+        while (e > p && is_ws(e[-1])) --e;
+        if (p == e) return;
+        const char c = *p;
+        long long a, b;
+        if (d == GraphDialect::SA) {
+            if (c == 'c' || c == 'C' || c == '#' || c == '%' || c == '/') return;
+            if (c == 'p' || c == 'P') {
+                if (body) { irregular = true; return; }
+                const char* q = skip_word(skip_word(p, e), e);
+                if (next_int(q, e, a) && a > 0) S.declared_n = a;
+                return;
+            }
+            data = true;
+            if (next_int(p, e, a) && next_int(p, e, b)) {
+                if (a >= 0 && b >= 0 && a <= INT_MAX && b <= INT_MAX) edge(a, b);
+                else ++S.dropped;
+            }
+            return;
+        }
+        // GA
+        if (c == 'c' || c == '#') return;
+        if (c == 'p') {
+            if (body) { irregular = true; return; }
+            in_dimacs = true;
+            const char* q = p;
+            while (q < e && !is_ws(*q)) ++q;
+            if (q - p != 1) return;   // la etiqueta debe ser "p"
+            q = skip_word(q, e);
+            if (next_int(q, e, a) && a > 0) S.declared_n = a;
+            return;
+        }
+        if (in_dimacs) {
+            const char* q = p + 1;
+            if ((c == 'e' || c == 'a') && next_int(q, e, a) && next_int(q, e, b)) {
+                data = true;
+                edge(a, b);
+                return;
+            }
+            q = p;
+            if (next_int(q, e, a) && next_int(q, e, b)) { data = true; edge(a, b); }
+            return;
+        }
+        long long tok[3];
+        int k = 0;
+        const char* q = p;
+        while (k < 3 && next_int(q, e, tok[k])) ++k;
+        if (k == 1 && S.declared_n < 0 && !saw_header_n && !saw_header_nm) {
+            if (body) { irregular = true; return; }
+            S.declared_n = tok[0];
+            saw_header_n = true;
+        } else if (k == 2 && S.declared_n < 0 && !saw_header_nm) {
+            if (body) { irregular = true; return; }
+            S.declared_n = tok[0];
+            saw_header_nm = true;
+        } else if (k >= 2) {
+            data = true;
+            edge(tok[0], tok[1]);
+        }
+    }
+};
+
+// Pasada secuencial (getline). S se actualiza durante la pasada: emit puede
+// mirar p.ej. S.declared_n
+template <class Emit>
+inline void scan(const std::string& path, GraphDialect d, EdgeScan& S, Emit emit) {
+    S = EdgeScan{};
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return;
+    S.opened = true;
+    LineParser P;
+    P.d = d;
+    auto edge = [&](long long u, long long v) { note_edge(S, u, v); emit(u, v); };
+    char* buf = nullptr;
+    size_t cap = 0;
+    ssize_t len;
+    try {
+        while (!P.done && (len = getline(&buf, &cap, f)) != -1) P.line(buf, buf + len, S, edge, path);
+    } catch (...) {
+        std::free(buf);
+        std::fclose(f);
+        throw;
+    }
+    std::free(buf);
+    std::fclose(f);
+    if (d == GraphDialect::Plain && !P.plain_header)
+        throw std::runtime_error("Encabezado inválido en: " + path);
+}
+
+// n y base (0/1) según el dialecto; false si el archivo no describe un grafo
+inline bool resolve(const EdgeScan& S, GraphDialect d, int& n, long long& base) {
+    long long nn = -1;
+    base = 0;
+    if (d == GraphDialect::Plain) {
+        nn = S.declared_n;
+    } else if (d == GraphDialect::SA) {
+        const bool one_based = !S.saw_zero && S.saw_one;
+        base = one_based ? 1 : 0;
+        if (S.declared_n > 0) nn = S.declared_n;
+        else if (S.edges > 0) nn = S.max_id + (one_based ? 0 : 1);
+    } else {
+        base = S.saw_zero ? 0 : 1;
+        if (S.declared_n < 0 && S.edges == 0) return false;
+        nn = S.declared_n;
+        if (nn < 0) nn = S.saw_zero ? S.max_id + 1 : S.max_id;
+    }
+    if (nn <= 0) return false;
+    if (nn > INT_MAX) throw std::runtime_error("n = " + std::to_string(nn) + " no cabe en int");
+    n = (int)nn;
+    return true;
+}
+
+// Grados por vértice (0-based, ya con la base aplicada) para reservar: cota
+// superior, incluye duplicados. El contador crece con el id crudo más grande
+// visto; sin n declarado (dialecto SA) un solo id enorme bastaba para pedir
+// GB antes de que load_adjacency mirara --mem_limit. Un id u implica al menos
+// u filas, así que el límite se revisa antes de cada crecimiento.
+struct DegreeCount {
+    std::vector<uint32_t> cnt;   // por id crudo
+    long long cap_id = LLONG_MAX;
+    size_t mem_limit = 0;        // --mem_limit (0 = sin límite)
+    long long adds = 0;          // extremos contados hasta ahora
+
+    void add(long long u) {
+        if (u < 0 || u > cap_id) return;
+        ++adds;
+        if ((size_t)u >= cnt.size()) grow((size_t)u);
+        ++cnt[u];
+    }
+    void grow(size_t u) {
+        check_mem_limit(adjacency_bytes((long long)u, adds) + (u + 1) * sizeof(uint32_t), mem_limit, "el grafo");
+        cnt.resize(std::max(u + 1, cnt.size() * 2), 0);
+    }
+    uint32_t of(int u, long long base) const {
+        const size_t i = (size_t)(u + base);
+        return i < cnt.size() ? cnt[i] : 0;
+    }
+};
+
+// Pasada 1 completa: grados, n y base. false si no es un grafo.
+inline bool count_pass(const std::string& path, GraphDialect d, DegreeCount& D,
+                       int& n, long long& base, EdgeScan& S) {
+    scan(path, d, S, [&](long long u, long long v) {
+        if (u == v) return;
+        if (S.declared_n > 0) D.cap_id = S.declared_n;   // ids mayores quedan fuera
+        D.add(u);
+        D.add(v);
+    });
+    if (!S.opened) return false;
+    if (!resolve(S, d, n, base)) return false;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Carga en paralelo (--load_threads)
+// ---------------------------------------------------------------------------
+
+// Archivos más chicos se leen con la pasada secuencial
+constexpr size_t kParMinBytes = size_t(1) << 20;
+// Cada cuánto un trozo suelta lo ya leído del mapeo (MappedFile::release)
+constexpr ptrdiff_t kReleaseBytes = ptrdiff_t(32) << 20;
+
+// Archivo mapeado en memoria, solo lectura. data == nullptr si no se pudo
+// abrir o mapear (vacío, tubería...): ahí se usa scan().
+struct MappedFile {
+    const char* data = nullptr;
+    size_t size = 0;
+
+    explicit MappedFile(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                data = static_cast<const char*>(p);
+                size = (size_t)st.st_size;
+                madvise(p, size, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+    }
+    ~MappedFile() { if (data) munmap((void*)data, size); }
+
+    // Suelta las páginas ya leídas de [from, to): siguen en la caché de
+    // páginas, pero dejan de contar en el RSS del proceso. Devuelve dónde
+    // quedó el corte (alineado a página).
+    const char* release(const char* from, const char* to) const {
+        const uintptr_t pg = (uintptr_t)sysconf(_SC_PAGESIZE);
+        const uintptr_t a = ((uintptr_t)from + pg - 1) / pg * pg, b = (uintptr_t)to / pg * pg;
+        if (b > a) madvise((void*)a, b - a, MADV_DONTNEED);
+        return b > a ? (const char*)b : from;
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+// f(t) para t en [0, T), un hilo por t (el 0 es el llamador). La excepción de
+// cada hilo queda en err[t].
+template <class F>
+inline void run_threads(int T, std::vector<std::exception_ptr>& err, F f) {
+    err.assign(T, nullptr);
+    auto guarded = [&](int t) {
+        try { f(t); } catch (...) { err[t] = std::current_exception(); }
+    };
+    std::vector<std::thread> th;
+    th.reserve(T - 1);
+    for (int t = 1; t < T; ++t) th.emplace_back(guarded, t);
+    guarded(0);
+    for (auto& x : th) x.join();
+}
+
+inline void rethrow_first(const std::vector<std::exception_ptr>& err) {
+    for (auto& e : err) if (e) std::rethrow_exception(e);
+}
+
+// Cortes [cut[t], cut[t+1]) de las filas [0, n) con peso w(u) parecido por hilo
+template <class W>
+inline std::vector<int> balanced_cuts(int T, int n, W w) {
+    long long total = 0;
+    for (int u = 0; u < n; ++u) total += (long long)w(u);
+    std::vector<int> cut(T + 1, n);
+    cut[0] = 0;
+    long long acc = 0;
+    int t = 1;
+    for (int u = 0; u < n && t < T; ++u) {
+        acc += (long long)w(u);
+        while (t < T && acc * T >= total * t) cut[t++] = u + 1;
+    }
+    return cut;
+}
+
+// Contador por hilo en su propia línea de caché
+struct alignas(64) PaddedCount { long long v = 0; };
+
+/**
+ * Una pasada por el archivo mapeado en T hilos. El prefijo (cabeceras, hasta
+ * la primera línea de aristas) se lee en el hilo llamador. El resto se corta
+ * en T trozos de líneas completas, uno por hilo, en el orden del archivo.
+ * emit_for(t, St) devuelve el emisor del trozo t; St es el EdgeScan propio
+ * del trozo, y el prefijo usa emit_for(0, S). Devuelve false si algún trozo
+ * encontró una línea irregular (ver LineParser): hay que usar scan().
+ */
+template <class EmitFor>
+inline bool par_scan(const MappedFile& F, GraphDialect d, int T, EdgeScan& S,
+                     EmitFor emit_for, const std::string& path) {
+    S = EdgeScan{};
+    S.opened = true;
+    LineParser P;
+    P.d = d;
+    const char* p = F.data;
+    const char* const end = F.data + F.size;
+    auto next_line = [end](const char* q) {
+        const char* nl = static_cast<const char*>(std::memchr(q, '\n', end - q));
+        return nl ? nl : end;
+    };
+    {
+        auto emit = emit_for(0, S);
+        auto edge = [&](long long u, long long v) { note_edge(S, u, v); emit(u, v); };
+        while (p < end && !P.done && !P.stable()) {
+            const char* le = next_line(p);
+            P.line(p, le, S, edge, path);
+            p = le < end ? le + 1 : end;
+        }
+    }
+    if (P.done) p = end;
+
+    std::vector<const char*> cut(T + 1, end);
+    cut[0] = p;
+    for (int t = 1; t < T; ++t) {
+        const char* q = p + (end - p) / T * t;
+        if (q < cut[t - 1]) q = cut[t - 1];
+        if (q > p && q < end && q[-1] != '\n') {
+            q = next_line(q);
+            if (q < end) ++q;
+        }
+        cut[t] = q;
+    }
+
+    std::vector<EdgeScan> St(T);
+    std::vector<char> irregular(T, 0);
+    std::vector<std::exception_ptr> err;
+    run_threads(T, err, [&](int t) {
+        EdgeScan& L = St[t];
+        L.opened = true;
+        L.declared_n = S.declared_n;
+        LineParser Q = P;
+        Q.body = true;
+        auto emit = emit_for(t, L);
+        auto edge = [&](long long u, long long v) { note_edge(L, u, v); emit(u, v); };
+        const char* released = cut[t];
+        for (const char* q = cut[t]; q < cut[t + 1] && !Q.done && !Q.irregular;) {
+            const char* le = next_line(q);
+            Q.line(q, le, L, edge, path);
+            q = le < end ? le + 1 : end;
+            if (q - released >= kReleaseBytes) released = F.release(released, q);
+        }
+        irregular[t] = Q.irregular;
+    });
+    // Un trozo irregular invalida lo que vino después (p.ej. pares de Plain
+    // desalineados): sus errores tampoco cuentan
+    for (int t = 0; t < T; ++t) if (irregular[t]) return false;
+    rethrow_first(err);
+    for (const EdgeScan& L : St) {
+        S.max_id = std::max(S.max_id, L.max_id);
+        S.saw_zero |= L.saw_zero;
+        S.saw_one |= L.saw_one;
+        S.edges += L.edges;
+        S.dropped += L.dropped;
+    }
+    if (d == GraphDialect::Plain && !P.plain_header)
+        throw std::runtime_error("Encabezado inválido en: " + path);
+    return true;
+}
+
+enum class ParLoad { Done, NotGraph, Fallback };
+
+// Pasada 1 en paralelo: un histograma de grados por trozo (por id crudo), n y base
+inline ParLoad par_count_pass(const MappedFile& F, const std::string& path, GraphDialect d, int T,
+                              std::vector<DegreeCount>& H, int& n, long long& base, EdgeScan& S,
+                              size_t mem_limit = 0) {
+    H.assign(T, DegreeCount{});
+    for (DegreeCount& D : H) D.mem_limit = mem_limit;
+    const bool ok = par_scan(F, d, T, S, [&H](int t, EdgeScan& L) {
+        DegreeCount* D = &H[t];
+        const EdgeScan* Ls = &L;
+        return [D, Ls](long long u, long long v) {
+            if (u == v) return;
+            if (Ls->declared_n > 0) D->cap_id = Ls->declared_n;   // ids mayores quedan fuera
+            D->add(u);
+            D->add(v);
+        };
+    }, path);
+    if (!ok) return ParLoad::Fallback;
+    return resolve(S, d, n, base) ? ParLoad::Done : ParLoad::NotGraph;
+}
+
+// Suma de los histogramas sobre los ids del grafo, y bytes que ocupan
+inline long long histogram_total(const std::vector<DegreeCount>& H, int n, long long base, size_t* bytes) {
+    long long total = 0;
+    size_t b = 0;
+    for (const DegreeCount& D : H) {
+        b += D.cnt.capacity() * sizeof(uint32_t);
+        const size_t hi = std::min(D.cnt.size(), (size_t)(n + base));
+        for (size_t i = (size_t)base; i < hi; ++i) total += D.cnt[i];
+    }
+    if (bytes) *bytes = b;
+    return total;
+}
+
+// H[t].cnt[i] (grado del id crudo i en el trozo t) pasa a ser el cursor del
+// trozo t dentro de la fila de i: la suma de los grados de los trozos
+// anteriores. deg(u, total) recibe el grado de cada fila. Así cada trozo
+// escribe en posiciones propias, sin atómicos, y en el orden del archivo.
+template <class Deg>
+inline void histograms_to_cursors(std::vector<DegreeCount>& H, int n, long long base, Deg deg) {
+    for (int u = 0; u < n; ++u) {
+        const size_t i = (size_t)(u + base);
+        uint32_t s = 0;
+        for (DegreeCount& D : H) {
+            if (i >= D.cnt.size()) continue;
+            const uint32_t c = D.cnt[i];
+            D.cnt[i] = s;
+            s += c;
+        }
+        deg(u, s);
+    }
+}
+
+// Pasada 2 en paralelo: fill(t, u, v) escribe v en la fila de u (ids ya
+// 0-based y en rango). Devuelve las aristas escritas.
+template <class Fill>
+inline long long par_fill_pass(const MappedFile& F, const std::string& path, GraphDialect d, int T,
+                               int n, long long base, Fill fill) {
+    std::vector<PaddedCount> m(T);
+    EdgeScan S;
+    par_scan(F, d, T, S, [&](int t, EdgeScan&) {
+        return [&fill, &m, t, n, base](long long u, long long v) {
+            u -= base;
+            v -= base;
+            if (u < 0 || v < 0 || u >= n || v >= n || u == v) return;
+            fill(t, (int)u, (int)v);
+            fill(t, (int)v, (int)u);
+            ++m[t].v;
+        };
+    }, path);
+    long long total = 0;
+    for (auto& c : m) total += c.v;
+    return total;
+}
+
+/**
+ * load_adjacency en T hilos. Las filas se reservan con su grado exacto,
+ * rellenas con -1: un conteo puede superar a lo escrito (ids fuera de rango
+ * con n declarado), y esos huecos se quitan al final. El orden de cada fila
+ * sale igual que en la pasada secuencial. El sort y el dedupe van en
+ * paralelo por rangos de filas de peso parecido.
+ */
+inline ParLoad par_load_adjacency(const MappedFile& F, const std::string& path, GraphDialect d, int T,
+                                  int& n, std::vector<std::vector<int>>& adj, long long* m_out,
+                                  size_t mem_limit) {
+    std::vector<DegreeCount> H;
+    EdgeScan S;
+    long long base = 0;
+    const ParLoad r = par_count_pass(F, path, d, T, H, n, base, S, mem_limit);
+    if (r != ParLoad::Done) return r;
+    if (S.dropped > 0)
+        std::cerr << "[WARN] Ignorando " << S.dropped << " aristas con ids negativos o mayores que INT_MAX\n";
+
+    size_t hist_bytes = 0;
+    const long long total = histogram_total(H, n, base, &hist_bytes);
+    check_mem_limit(adjacency_bytes(n, total) + hist_bytes, mem_limit, "el grafo");
+
+    adj.assign(n, {});
+    histograms_to_cursors(H, n, base, [&](int u, uint32_t k) { if (k) adj[u].assign(k, -1); });
+
+    long long m = par_fill_pass(F, path, d, T, n, base, [&](int t, int u, int v) {
+        adj[u][H[t].cnt[(size_t)(u + base)]++] = v;
+    });
+    H = std::vector<DegreeCount>();
+
+    const bool dedupe = d != GraphDialect::Plain;
+    const bool gaps = 2 * m != total;
+    if (dedupe || gaps) {
+        const std::vector<int> cut = balanced_cuts(T, n, [&](int u) { return adj[u].size(); });
+        std::vector<PaddedCount> deg(T);
+        std::vector<std::exception_ptr> err;
+        run_threads(T, err, [&](int t) {
+            for (int u = cut[t]; u < cut[t + 1]; ++u) {
+                auto& a = adj[u];
+                if (dedupe) {
+                    if (!std::is_sorted(a.begin(), a.end())) std::sort(a.begin(), a.end());
+                    a.erase(std::unique(a.begin(), a.end()), a.end());
+                    a.erase(a.begin(), std::lower_bound(a.begin(), a.end(), 0));
+                } else {
+                    a.erase(std::remove(a.begin(), a.end(), -1), a.end());
+                }
+                deg[t].v += (long long)a.size();
+            }
+        });
+        rethrow_first(err);
+        if (dedupe) {
+            m = 0;
+            for (auto& c : deg) m += c.v;
+            m /= 2;
+        }
+    }
+    if (m_out) *m_out = m;
+    return ParLoad::Done;
+}
+
+} // namespace gload
+
+/**
+ * Listas de adyacencia 0-based desde path en dos pasadas. Devuelve false si
+ * no se puede abrir o no describe un grafo (el llamador decide el mensaje);
+ * lanza std::runtime_error en los errores de Plain y si se excede mem_limit.
+ * m_out: aristas (Plain: pares leídos sin lazos; si no, aristas distintas).
+ */
+inline bool load_adjacency(const std::string& path, GraphDialect d, int& n,
+                           std::vector<std::vector<int>>& adj, long long* m_out = nullptr,
+                           size_t mem_limit = 0) {
+    {
+        gload::MappedFile F(path);
+        if (F.data && F.size >= gload::kParMinBytes) {
+            const gload::ParLoad r = gload::par_load_adjacency(F, path, d, load_threads(), n, adj, m_out, mem_limit);
+            if (r != gload::ParLoad::Fallback) return r == gload::ParLoad::Done;
+        }
+    }
+    gload::DegreeCount D;
+    D.mem_limit = mem_limit;
+    gload::EdgeScan S;
+    long long base = 0;
+    if (!gload::count_pass(path, d, D, n, base, S)) return false;
+    if (S.dropped > 0)
+        std::cerr << "[WARN] Ignorando " << S.dropped << " aristas con ids negativos o mayores que INT_MAX\n";
+
+    long long total = 0;
+    for (int u = 0; u < n; ++u) total += D.of(u, base);
+    check_mem_limit(adjacency_bytes(n, total), mem_limit, "el grafo");
+
+    adj.assign(n, {});
+    for (int u = 0; u < n; ++u)
+        if (const uint32_t k = D.of(u, base)) adj[u].reserve(k);
+    D.cnt = std::vector<uint32_t>();
+
+    long long m = 0;
+    gload::scan(path, d, S, [&](long long u, long long v) {
+        u -= base;
+        v -= base;
+        if (u < 0 || v < 0 || u >= n || v >= n || u == v) return;
+        adj[(int)u].push_back((int)v);
+        adj[(int)v].push_back((int)u);
+        ++m;
+    });
+    if (d != GraphDialect::Plain) {
+        m = 0;
+        for (auto& a : adj) {
+            if (!std::is_sorted(a.begin(), a.end())) std::sort(a.begin(), a.end());
+            a.erase(std::unique(a.begin(), a.end()), a.end());
+            m += (long long)a.size();
+        }
+        m /= 2;
+    }
+    if (m_out) *m_out = m;
+    return true;
+}
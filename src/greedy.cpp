@@ -1,60 +1,124 @@
 #include <iostream>
 #include <iomanip>
 #include <vector>
-#include <climits>
+#include <string>
+#include <thread>
 #include "graph_io.hpp"
 #include "utils.hpp"
+#include "luby.hpp"
+#include "gen/gnp.hpp"
+#include "greedy.hpp"
+#include "telemetry.hpp"
+#include "hugepages.hpp"
+
+TEL_DEFINE_ALLOC_HOOKS()
 
 /**
  * Heurística greedy determinista para MIS:
  *  - Mientras queden nodos "vivos", elige el de menor grado actual,
  *    lo agrega a la solución y elimina ese nodo y sus vecinos.
- * Entrada:  -i <instancia.graph>
+ * Entrada:  -i <instancia.graph>  |  --gen n,p,seed (G(n,p) en memoria)
  * Salida (stdout): "<valor> <tiempo>"
+ *
+ * Modo paralelo (--parallel): rondas de Luby sobre CSR (luby.hpp) para
+ * grafos grandes.
+ *   --threads T                 hilos (defecto: núcleos disponibles)
+ *   --priority random|mindeg    prioridad aleatoria o sesgada a grado mínimo
+ *   --eps e                     ventana de grado de mindeg (defecto 0.5)
+ *   --seed s                    semilla de las prioridades (defecto 1)
+ *   --hugepages                 CSR y arreglos de Luby en páginas de 2 MB
+ *                               (hugepages.hpp); "#hugepages: ..." en stderr
+ * stderr: "#luby: threads=.. priority=.. rounds=.. csr_time=.."
+ *   (csr_time: leer el archivo, o generar el G(n,p), directo a CSR en dos
+ *   pasadas, sin pasar por listas de adyacencia; csr.hpp)
+ * --mem_limit 8G: aborta antes de reservar si el grafo no entra (graph_load.hpp)
+ * --load_threads T: hilos de la carga, también sin --parallel (0 = uno por
+ *   núcleo, 1 = secuencial)
+ * --stats json: línea JSON en stderr con tiempos por fase y memoria
  */
 int main(int argc, char** argv) {
-    std::string in_path;
+    std::string in_path, gen;
+    bool parallel = false;
+    int threads = std::max(1, (int)std::thread::hardware_concurrency());
+    std::string priority = "random";
+    unsigned long long seed = 1;
+    double eps = 0.5;
+    std::string stats;
+    bool hugepages = false;
+    size_t mem_limit = 0;
+    int load_threads = 0;
     for (int i = 1; i < argc; ++i) {
         std::string a = argv[i];
         if ((a == "-i" || a == "--input") && i + 1 < argc) in_path = argv[++i];
+        else if (a == "--gen" && i + 1 < argc) gen = argv[++i];
+        else if (a == "--parallel") parallel = true;
+        else if (a == "--threads" && i + 1 < argc) threads = std::max(1, std::stoi(argv[++i]));
+        else if (a == "--priority" && i + 1 < argc) priority = argv[++i];
+        else if (a == "--seed" && i + 1 < argc) seed = std::stoull(argv[++i]);
+        else if (a == "--eps" && i + 1 < argc) eps = std::stod(argv[++i]);
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
+        else if (a == "--hugepages") hugepages = true;
+        else if (a == "--mem_limit" && i + 1 < argc) mem_limit = parse_mem_limit(argv[++i]);
+        else if (a == "--load_threads" && i + 1 < argc) load_threads = std::stoi(argv[++i]);
     }
-    if (in_path.empty()) return 1;
-
-    Graph G = load_graph(in_path);
-    const int n = G.n;
-
-    std::vector<char> alive(n, 1);
-    std::vector<int> deg(n);
-    for (int u = 0; u < n; ++u) deg[u] = (int)G.adj[u].size();
-
-    int solution_size = 0;
-    int alive_count = n;
+    if (in_path.empty() && gen.empty()) return 1;
+    if (priority != "random" && priority != "mindeg") {
+        std::cerr << "--priority debe ser random o mindeg\n";
+        return 1;
+    }
+    if (!tel::enable("Greedy", stats)) {
+        std::cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+    if (hugepages && parallel) huge::enable();
+    set_load_threads(load_threads);
 
-    double t0 = now_seconds();
-    while (alive_count > 0) {
-        // Selección: vértice con menor grado actual
-        int best = -1, best_deg = INT_MAX;
-        for (int u = 0; u < n; ++u) if (alive[u]) {
-            if (deg[u] < best_deg) { best_deg = deg[u]; best = u; }
+    if (parallel) {
+        double tc = now_seconds();
+        CSR C;
+        try {
+            C = gen.empty() ? load_csr(in_path, GraphDialect::Plain, mem_limit)
+                            : gnp_csr(parse_gen_spec(gen), nullptr, mem_limit);
+        } catch (const std::exception& e) {
+            std::cerr << "ERROR: " << e.what() << "\n";
+            return 1;
         }
-        if (best == -1) break;
+        tc = now_seconds() - tc;
 
-        ++solution_size;
+        TEL_PHASE("main_loop");
+        double t0 = now_seconds();
+        LubyResult R = parallel_luby(C, threads, seed,
+                                     priority == "mindeg" ? LUBY_MINDEG : LUBY_RANDOM, eps);
+        double elapsed = now_seconds() - t0;
+        TEL_PHASE("output");
 
-        // Eliminar elegido y sus vecinos; actualizar grados
-        std::vector<int> to_remove;
-        to_remove.reserve(1 + G.adj[best].size());
-        to_remove.push_back(best);
-        for (int v : G.adj[best]) if (alive[v]) to_remove.push_back(v);
+        std::cerr << "#luby: threads=" << threads << " priority=" << priority
+                  << " rounds=" << R.rounds
+                  << " csr_time=" << std::fixed << std::setprecision(6) << tc << "\n";
+        huge::report();
+        std::cout << R.size << " "
+                  << std::fixed << std::setprecision(6) << elapsed << "\n";
+        return 0;
+    }
 
-        for (int r : to_remove) if (alive[r]) {
-            alive[r] = 0; --alive_count;
-            for (int w : G.adj[r]) if (alive[w]) --deg[w];
+    Graph G;
+    try {
+        if (!gen.empty()) {
+            GenSpec gs = parse_gen_spec(gen);
+            G.n = gs.n;
+            G.adj = gnp_adjacency(gs, &G.m, mem_limit);
+        } else {
+            G = load_graph(in_path, mem_limit);
         }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
     }
-    double elapsed = now_seconds() - t0;
 
-    std::cout << solution_size << " "
-              << std::fixed << std::setprecision(6) << elapsed << "\n";
+    GreedyResult R = greedy_min_degree(G);
+    TEL_PHASE("output");
+
+    std::cout << R.size << " "
+              << std::fixed << std::setprecision(6) << R.time << "\n";
     return 0;
 }
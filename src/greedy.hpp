@@ -0,0 +1,186 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <climits>
+#include "graph_io.hpp"
+#include "utils.hpp"
+#include "telemetry.hpp"
+
+/**
+ * Constructivos greedy para MIS (los usan build/Greedy, build/Greedy-probabilista
+ * y el driver mis-bench).
+ * time: segundos del bucle principal (sin contar la preparación de grados).
+ * sol: vértices elegidos, en orden de elección.
+ */
+struct GreedyResult {
+    int size = 0;
+    double time = 0.0;
+    std::vector<int> sol;
+};
+
+/**
+ * Vértice vivo de menor (grado actual, id): el mismo que elegiría recorrer
+ * 0..n-1 quedándose con el primer grado mínimo. Las hojas son bloques de 64
+ * ids y encima hay un árbol de torneo sobre los bloques, así que:
+ *  - bajar el grado de u solo sube por el árbol mientras u gane;
+ *  - sacar u reescanea su bloque (64 lecturas contiguas) si era el ganador.
+ * Con n = 10^7 el recorrido completo por elección hacía al greedy O(n·|S|).
+ */
+struct MinDegreeTree {
+    static constexpr int B = 64;
+    const std::vector<int>& deg;
+    const std::vector<char>& alive;
+    int n, leaves = 1;
+    std::vector<int> win;   // ganador de cada nodo (-1: nadie vivo); hojas en [leaves, 2·leaves)
+
+    MinDegreeTree(const std::vector<int>& d, const std::vector<char>& a)
+        : deg(d), alive(a), n((int)d.size()) {
+        const int blocks = (n + B - 1) / B;
+        while (leaves < blocks) leaves <<= 1;
+        win.assign(2 * (size_t)leaves, -1);
+        for (int b = 0; b < blocks; ++b) win[leaves + b] = scan(b);
+        for (int i = leaves - 1; i >= 1; --i) win[i] = pick(win[2 * i], win[2 * i + 1]);
+    }
+    int top() const { return win[1]; }
+
+    // a antes que b: menor grado y, a igual grado, menor id
+    bool less(int a, int b) const {
+        if (a < 0) return false;
+        if (b < 0) return true;
+        return deg[a] < deg[b] || (deg[a] == deg[b] && a < b);
+    }
+    int pick(int a, int b) const { return less(b, a) ? b : a; }
+    int scan(int b) const {
+        int best = -1;
+        for (int u = b * B, e = std::min(n, u + B); u < e; ++u)
+            if (alive[u] && (best < 0 || deg[u] < deg[best])) best = u;
+        return best;
+    }
+
+    // deg[u] acaba de bajar (u vivo)
+    void decreased(int u) {
+        for (int i = leaves + u / B; i >= 1; i >>= 1) {
+            if (win[i] == u) continue;
+            if (!less(u, win[i])) return;
+            win[i] = u;
+        }
+    }
+    // alive[u] acaba de pasar a 0
+    void removed(int u) {
+        int i = leaves + u / B;
+        if (win[i] != u) return;
+        win[i] = scan(u / B);
+        for (i >>= 1; i >= 1 && win[i] == u; i >>= 1) win[i] = pick(win[2 * i], win[2 * i + 1]);
+    }
+};
+
+/**
+ * Greedy determinista: mientras queden nodos "vivos", elige el de menor
+ * grado actual (a igual grado, el de menor id), lo agrega a la solución y
+ * elimina ese nodo y sus vecinos. La elección sale de MinDegreeTree.
+ * Gr: cualquier grafo con n y adj[u] de ints (Graph, o la vista de libmis).
+ */
+template <class Gr>
+inline GreedyResult greedy_min_degree(const Gr& G) {
+    TEL_PHASE("init");
+    const int n = G.n;
+    std::vector<char> alive(n, 1);
+    std::vector<int> deg(n);
+    for (int u = 0; u < n; ++u) deg[u] = (int)G.adj[u].size();
+    MinDegreeTree T(deg, alive);
+
+    int solution_size = 0;
+    std::vector<int> sol;
+    std::vector<int> to_remove;
+
+    TEL_PHASE("main_loop");
+    double t0 = now_seconds();
+    for (;;) {
+        // Selección: vértice con menor grado actual
+        const int best = T.top();
+        if (best == -1) break;
+
+        ++solution_size;
+        sol.push_back(best);
+
+        // Eliminar elegido y sus vecinos; actualizar grados
+        to_remove.clear();
+        to_remove.push_back(best);
+        for (int v : G.adj[best]) if (alive[v]) to_remove.push_back(v);
+
+        for (int r : to_remove) if (alive[r]) {
+            alive[r] = 0;
+            T.removed(r);
+            for (int w : G.adj[r]) if (alive[w]) { --deg[w]; T.decreased(w); }
+        }
+    }
+    TEL_COUNT("greedy.picks", solution_size);
+    return {solution_size, now_seconds() - t0, std::move(sol)};
+}
+
+/**
+ * Greedy aleatorizado (RCL-α):
+ *  - umbral = d_min + α (d_max - d_min) sobre los grados vivos;
+ *  - RCL = {u vivos con grado[u] <= umbral};
+ *  - elige u aleatorio en RCL, lo agrega y elimina u y sus vecinos.
+ */
+template <class Gr>
+inline GreedyResult greedy_rcl(const Gr& G, double alpha, unsigned seed) {
+    TEL_PHASE("init");
+    const int n = G.n;
+    std::vector<char> alive(n, 1);
+    std::vector<int> deg(n);
+    for (int u = 0; u < n; ++u) deg[u] = (int)G.adj[u].size();
+
+    std::mt19937 rng(seed);
+    int solution_size = 0;
+    std::vector<int> sol;
+    int alive_count = n;
+
+    TEL_PHASE("main_loop");
+    double t0 = now_seconds();
+    while (alive_count > 0) {
+        // Rango de grados en los nodos vivos
+        int dmin = INT_MAX, dmax = -1;
+        for (int u = 0; u < n; ++u) if (alive[u]) {
+            if (deg[u] < dmin) dmin = deg[u];
+            if (deg[u] > dmax) dmax = deg[u];
+        }
+        if (dmin == INT_MAX) break;
+
+        // Umbral para construir RCL
+        const double thr = dmin + alpha * (double)(dmax - dmin);
+
+        std::vector<int> RCL;
+        RCL.reserve(64);
+        for (int u = 0; u < n; ++u) if (alive[u]) {
+            if ((double)deg[u] <= thr) RCL.push_back(u);
+        }
+        // Salvaguarda: si RCL queda vacía, agregamos un vivo cualquiera
+        if (RCL.empty()) {
+            for (int u = 0; u < n; ++u) if (alive[u]) { RCL.push_back(u); break; }
+        }
+
+        // Elección aleatoria dentro de RCL
+        std::uniform_int_distribution<int> dist(0, (int)RCL.size() - 1);
+        int chosen = RCL[dist(rng)];
+        TEL_COUNT("greedy.rcl_candidates", (long long)RCL.size());
+
+        ++solution_size;
+        sol.push_back(chosen);
+
+        // Eliminación del elegido y de sus vecinos; actualización de grados
+        std::vector<int> to_remove;
+        to_remove.reserve(1 + G.adj[chosen].size());
+        to_remove.push_back(chosen);
+        for (int v : G.adj[chosen]) if (alive[v]) to_remove.push_back(v);
+
+        for (int r : to_remove) if (alive[r]) {
+            alive[r] = 0; --alive_count;
+            for (int w : G.adj[r]) if (alive[w]) --deg[w];
+        }
+    }
+    TEL_COUNT("greedy.picks", solution_size);
+    return {solution_size, now_seconds() - t0, std::move(sol)};
+}
@@ -1,10 +1,13 @@
 #include <iostream>
 #include <iomanip>
-#include <vector>
-#include <random>
-#include <climits>
+#include <string>
 #include "graph_io.hpp"
 #include "utils.hpp"
+#include "gen/gnp.hpp"
+#include "greedy.hpp"
+#include "telemetry.hpp"
+
+TEL_DEFINE_ALLOC_HOOKS()
 
 /**
  * Heurística greedy aleatorizada para MIS (RCL-α):
@@ -13,76 +16,42 @@
  *  - Elige u aleatorio en RCL, lo agrega a la solución y elimina u y vecinos.
  * Parámetros:
  *  -i / --input <instancia.graph>
+ *  --gen n,p,seed    (G(n,p) generado en memoria en vez de -i)
  *  --alpha <0..1>     (default 0.3)
  *  --seed  <entero>   (default 12345)
+ *  --stats json     (línea JSON en stderr: fases, contadores, memoria)
  * Salida (stdout): "<valor> <tiempo>"
  */
 int main(int argc, char** argv) {
-    std::string in_path; double alpha = 0.3; unsigned seed = 12345;
+    std::string in_path, gen, stats; double alpha = 0.3; unsigned seed = 12345;
     for (int i = 1; i < argc; ++i) {
         std::string a = argv[i];
         if ((a == "-i" || a == "--input") && i + 1 < argc) in_path = argv[++i];
+        else if (a == "--gen" && i + 1 < argc) gen = argv[++i];
         else if (a == "--alpha" && i + 1 < argc) alpha = std::stod(argv[++i]);
         else if (a == "--seed"  && i + 1 < argc) seed  = (unsigned)std::stoul(argv[++i]);
+        else if (a == "--stats" && i + 1 < argc) stats = argv[++i];
     }
-    if (in_path.empty()) return 1;
+    if (in_path.empty() && gen.empty()) return 1;
     if (alpha < 0.0) alpha = 0.0;
     if (alpha > 1.0) alpha = 1.0;
+    if (!tel::enable("Greedy-probabilista", stats)) {
+        std::cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
 
-    Graph G = load_graph(in_path);
-    const int n = G.n;
-
-    std::vector<char> alive(n, 1);
-    std::vector<int> deg(n);
-    for (int u = 0; u < n; ++u) deg[u] = (int)G.adj[u].size();
-
-    std::mt19937 rng(seed);
-    int solution_size = 0;
-    int alive_count = n;
-
-    double t0 = now_seconds();
-    while (alive_count > 0) {
-        // Rango de grados en los nodos vivos
-        int dmin = INT_MAX, dmax = -1;
-        for (int u = 0; u < n; ++u) if (alive[u]) {
-            if (deg[u] < dmin) dmin = deg[u];
-            if (deg[u] > dmax) dmax = deg[u];
-        }
-        if (dmin == INT_MAX) break;
-
-        // Umbral para construir RCL
-        const double thr = dmin + alpha * (double)(dmax - dmin);
-
-        std::vector<int> RCL;
-        RCL.reserve(64);
-        for (int u = 0; u < n; ++u) if (alive[u]) {
-            if ((double)deg[u] <= thr) RCL.push_back(u);
-        }
-        // Salvaguarda: si RCL queda vacía, agregamos un vivo cualquiera
-        if (RCL.empty()) {
-            for (int u = 0; u < n; ++u) if (alive[u]) { RCL.push_back(u); break; }
-        }
-
-        // Elección aleatoria dentro de RCL
-        std::uniform_int_distribution<int> dist(0, (int)RCL.size() - 1);
-        int chosen = RCL[dist(rng)];
-
-        ++solution_size;
-
-        // Eliminación del elegido y de sus vecinos; actualización de grados
-        std::vector<int> to_remove;
-        to_remove.reserve(1 + G.adj[chosen].size());
-        to_remove.push_back(chosen);
-        for (int v : G.adj[chosen]) if (alive[v]) to_remove.push_back(v);
-
-        for (int r : to_remove) if (alive[r]) {
-            alive[r] = 0; --alive_count;
-            for (int w : G.adj[r]) if (alive[w]) --deg[w];
-        }
+    Graph G;
+    if (!gen.empty()) {
+        GenSpec gs = parse_gen_spec(gen);
+        G.n = gs.n;
+        G.adj = gnp_adjacency(gs, &G.m);
+    } else {
+        G = load_graph(in_path);
     }
-    double elapsed = now_seconds() - t0;
+    GreedyResult R = greedy_rcl(G, alpha, seed);
+    TEL_PHASE("output");
 
-    std::cout << solution_size << " "
-              << std::fixed << std::setprecision(6) << elapsed << "\n";
+    std::cout << R.size << " "
+              << std::fixed << std::setprecision(6) << R.time << "\n";
     return 0;
 }
@@ -0,0 +1,258 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+#include <malloc.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * Arena sobre páginas de 2 MB (--hugepages en SA, GA, solver_MISP y Greedy).
+ *
+ * Con n en cientos de miles, los accesos aleatorios a vecinos y a la palabra
+ * de estado de cada vértice fallan en el dTLB con páginas de 4 KB. Con
+ * --hugepages:
+ *
+ *  - huge::Allocator<T> (arreglos de estado de vertex_state.hpp, genomas del
+ *    GA, CSR de csr.hpp) reserva los bloques de >= 64 KB en una arena de
+ *    trozos de 2 MB alineados: primero hugetlbfs explícito (MAP_HUGETLB, si
+ *    hay páginas reservadas en /proc/sys/vm/nr_hugepages), si no THP
+ *    (madvise(MADV_HUGEPAGE)), y si tampoco, páginas normales. Los bloques
+ *    liberados quedan en una lista por tamaño: la población del GA reusa
+ *    siempre los mismos. Sin --hugepages el allocator es operator new.
+ *  - Las listas de adyacencia (vector<vector<int>>) no cambian de tipo: se
+ *    mantienen en el heap de malloc (M_MMAP_THRESHOLD alto) y, ya cargado el
+ *    grafo, collapse_heap() marca el heap con MADV_HUGEPAGE y lo compacta a
+ *    páginas de 2 MB con MADV_COLLAPSE (Linux >= 6.1; antes lo hace
+ *    khugepaged en segundo plano).
+ *
+ * report() escribe "#hugepages: mode=.. page_kb=.. arena_mb=.. heap_mb=..
+ * anon_huge_mb=.." (AnonHugePages de /proc/self/smaps_rollup: lo que el
+ * kernel realmente respaldó con páginas grandes); --stats json lo repite en
+ * "hugepages". Los fallos de dTLB salen en --perf ("dtlb_misses").
+ */
+namespace huge {
+
+#ifndef MADV_COLLAPSE
+#define MADV_COLLAPSE 25
+#endif
+
+enum class Mode { Off, Normal, THP, HugeTLB };
+
+inline const char* mode_name(Mode m) {
+    switch (m) {
+        case Mode::HugeTLB: return "hugetlb";
+        case Mode::THP:     return "thp";
+        case Mode::Normal:  return "4k";
+        default:            return "off";
+    }
+}
+
+constexpr size_t kPage = size_t(2) << 20;       // 2 MB
+constexpr size_t kChunk = size_t(64) << 20;     // trozo mínimo de la arena
+constexpr size_t kMinBlock = size_t(64) << 10;  // bloques menores: operator new
+
+inline size_t round_up(size_t x, size_t a) { return (x + a - 1) / a * a; }
+
+class Arena {
+public:
+    bool enabled() const { return mode_.load(std::memory_order_relaxed) != Mode::Off; }
+    Mode mode() const { return mode_.load(std::memory_order_relaxed); }
+    size_t mapped_bytes() const { return mapped_; }
+
+    // Elige el respaldo: hugetlbfs si hay páginas reservadas, si no THP
+    // (salvo que esté en "never"); grow() degrada si el mmap / madvise falla
+    void enable() {
+        std::lock_guard<std::mutex> lk(mtx_);
+        if (mode_ != Mode::Off) return;
+        if (read_long("/proc/sys/vm/nr_hugepages") > 0) mode_ = Mode::HugeTLB;
+        else if (thp_never()) mode_ = Mode::Normal;
+        else mode_ = Mode::THP;
+    }
+
+    bool owns(const void* p) const {
+        std::lock_guard<std::mutex> lk(mtx_);
+        return owns_locked(p);
+    }
+
+    void* allocate(size_t bytes) {
+        const size_t sz = round_up(bytes, 64);
+        std::lock_guard<std::mutex> lk(mtx_);
+        auto it = free_.find(sz);
+        if (it != free_.end() && !it->second.empty()) {
+            void* p = it->second.back();
+            it->second.pop_back();
+            return p;
+        }
+        if (cur_ + sz > end_ && !grow(sz)) return nullptr;
+        void* p = cur_;
+        cur_ += sz;
+        return p;
+    }
+
+    void release(void* p, size_t bytes) {
+        std::lock_guard<std::mutex> lk(mtx_);
+        free_[round_up(bytes, 64)].push_back(p);
+    }
+
+private:
+    struct Chunk { char* base; size_t len; };
+    mutable std::mutex mtx_;
+    std::atomic<Mode> mode_{Mode::Off};
+    std::vector<Chunk> chunks_;
+    std::map<size_t, std::vector<void*>> free_;
+    char* cur_ = nullptr;
+    char* end_ = nullptr;
+    size_t mapped_ = 0;
+
+    static long read_long(const char* path) {
+        FILE* f = std::fopen(path, "r");
+        if (!f) return -1;
+        long x = -1;
+        if (std::fscanf(f, "%ld", &x) != 1) x = -1;
+        std::fclose(f);
+        return x;
+    }
+    static bool thp_never() {
+        FILE* f = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+        if (!f) return true;
+        char buf[128] = {0};
+        const bool never = std::fgets(buf, sizeof(buf), f) && std::strstr(buf, "[never]");
+        std::fclose(f);
+        return never;
+    }
+
+    bool owns_locked(const void* p) const {
+        const char* c = static_cast<const char*>(p);
+        for (auto& k : chunks_) if (c >= k.base && c < k.base + k.len) return true;
+        return false;
+    }
+
+    // Nuevo trozo de al menos sz bytes; degrada hugetlb -> thp -> 4k
+    bool grow(size_t sz) {
+        const size_t len = round_up(sz > kChunk ? sz : kChunk, kPage);
+        void* p = MAP_FAILED;
+        if (mode_ == Mode::HugeTLB) {
+            p = mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p == MAP_FAILED) mode_ = Mode::THP;
+        }
+        if (p == MAP_FAILED) {
+            // Reservar de más para alinear a 2 MB y recortar los bordes
+            void* raw = mmap(nullptr, len + kPage, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) return false;
+            const uintptr_t r = (uintptr_t)raw;
+            const uintptr_t a = round_up(r, kPage);
+            if (a > r) munmap(raw, a - r);
+            if (r + kPage > a) munmap((void*)(a + len), r + kPage - a);
+            p = (void*)a;
+            if (mode_ == Mode::THP && madvise(p, len, MADV_HUGEPAGE) != 0) mode_ = Mode::Normal;
+        }
+        chunks_.push_back({static_cast<char*>(p), len});
+        mapped_ += len;
+        cur_ = static_cast<char*>(p);
+        end_ = cur_ + len;
+        return true;
+    }
+};
+
+inline Arena& arena() {
+    static Arena* a = new Arena;   // nunca se destruye: puede haber vectores vivos en atexit
+    return *a;
+}
+
+inline bool enabled() { return arena().enabled(); }
+
+// Allocator estándar: arena si --hugepages y el bloque es grande, si no operator new
+template <class T>
+struct Allocator {
+    using value_type = T;
+    Allocator() noexcept = default;
+    template <class U> Allocator(const Allocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (bytes >= kMinBlock && enabled())
+            if (void* p = arena().allocate(bytes)) return static_cast<T*>(p);
+        return static_cast<T*>(::operator new(bytes));
+    }
+    void deallocate(T* p, size_t n) noexcept {
+        const size_t bytes = n * sizeof(T);
+        if (bytes >= kMinBlock && enabled() && arena().owns(p)) arena().release(p, bytes);
+        else ::operator delete(p);
+    }
+    template <class U> bool operator==(const Allocator<U>&) const noexcept { return true; }
+    template <class U> bool operator!=(const Allocator<U>&) const noexcept { return false; }
+};
+
+template <class T>
+using vector = std::vector<T, Allocator<T>>;
+
+// Bytes del heap de malloc marcados y compactados por collapse_heap()
+inline size_t& heap_collapsed() { static size_t b = 0; return b; }
+
+/**
+ * --hugepages: activa la arena y deja las reservas de malloc en el heap
+ * (hasta 32 MB, el máximo de M_MMAP_THRESHOLD) para que collapse_heap()
+ * alcance también las listas de adyacencia. Llamar antes de cargar el grafo.
+ */
+inline void enable() {
+    arena().enable();
+    mallopt(M_MMAP_THRESHOLD, 32 << 20);
+    mallopt(M_TRIM_THRESHOLD, 1 << 30);
+}
+
+// Marca [heap] con MADV_HUGEPAGE y lo compacta (MADV_COLLAPSE). Devuelve bytes.
+inline size_t collapse_heap() {
+    if (!enabled()) return 0;
+    FILE* f = std::fopen("/proc/self/maps", "r");
+    if (!f) return 0;
+    char line[512];
+    uintptr_t lo = 0, hi = 0;
+    while (std::fgets(line, sizeof(line), f))
+        if (std::strstr(line, "[heap]")) { std::sscanf(line, "%lx-%lx", &lo, &hi); break; }
+    std::fclose(f);
+    lo = round_up(lo, kPage);
+    hi = hi / kPage * kPage;
+    if (hi <= lo) return 0;
+    const size_t len = hi - lo;
+    if (madvise((void*)lo, len, MADV_HUGEPAGE) != 0) return 0;
+    madvise((void*)lo, len, MADV_COLLAPSE);   // best effort: si falla, khugepaged
+    heap_collapsed() = len;
+    return len;
+}
+
+// AnonHugePages del proceso (kB), -1 si no se puede leer
+inline long anon_huge_kb() {
+    FILE* f = std::fopen("/proc/self/smaps_rollup", "r");
+    if (!f) return -1;
+    char line[256];
+    long kb = -1;
+    while (std::fgets(line, sizeof(line), f))
+        if (std::sscanf(line, "AnonHugePages: %ld kB", &kb) == 1) break;
+    std::fclose(f);
+    return kb;
+}
+
+inline long page_kb() {
+    const Mode m = arena().mode();
+    return (m == Mode::HugeTLB || m == Mode::THP) ? long(kPage >> 10) : sysconf(_SC_PAGESIZE) / 1024;
+}
+
+// "#hugepages: ..." en stderr
+inline void report() {
+    if (!enabled()) return;
+    std::fprintf(stderr, "#hugepages: mode=%s page_kb=%ld arena_mb=%.1f heap_mb=%.1f anon_huge_mb=%.1f\n",
+                 mode_name(arena().mode()), page_kb(), arena().mapped_bytes() / 1048576.0,
+                 heap_collapsed() / 1048576.0, anon_huge_kb() / 1024.0);
+}
+
+} // namespace huge
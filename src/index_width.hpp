@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Ancho de los ids de vértice y de los contadores de conflicto (conf),
+ * elegido al cargar el grafo (--width auto|32 en SA, GA y solver_MISP).
+ *
+ *  - ids de 16 bits si n <= 65536;
+ *  - contadores de 16 bits si el grado máximo es <= 32767: conf[v] nunca
+ *    supera el grado de v y va junto al bit de pertenencia en la misma
+ *    palabra (2·conf + in, vertex_state.hpp);
+ *  - si no, int, como siempre. No hace falta un ancho de 64 bits: n es int
+ *    en todo el repo.
+ *
+ * Los motores (sa::GraphT / MIS_SA_T, ga::GraphT / MISStateT,
+ * gals::GraphRT / MISStateT) se instancian con estos tipos. Con 16 bits las
+ * listas de adyacencia y conf ocupan la mitad, y los recorridos de vecinos y
+ * las actualizaciones de conf mueven la mitad de bytes (make bench:
+ * kernels *.w16 vs *.w32). Los resultados no cambian: solo cambia el tipo.
+ */
+enum class IndexWidth { I16_C16, I32_C16, I32_C32 };
+
+inline const char* index_width_name(IndexWidth w) {
+    switch (w) {
+        case IndexWidth::I16_C16: return "16/16";
+        case IndexWidth::I32_C16: return "32/16";
+        default:                  return "32/32";
+    }
+}
+
+// mode: "auto" (el más angosto que alcance) o "32" (ints, para comparar)
+inline IndexWidth pick_index_width(int n, const std::vector<std::vector<int>>& adj,
+                                   const std::string& mode = "auto") {
+    if (mode == "32") return IndexWidth::I32_C32;
+    if (mode != "auto") throw std::runtime_error("--width espera auto|32: " + mode);
+    size_t max_deg = 0;
+    for (const auto& a : adj) if (a.size() > max_deg) max_deg = a.size();
+    if (max_deg > 32767) return IndexWidth::I32_C32;
+    return n <= 65536 ? IndexWidth::I16_C16 : IndexWidth::I32_C16;
+}
+
+template <class T> struct TypeTag { using type = T; };
+
+// f(TypeTag<V>, TypeTag<C>) con los tipos de w
+template <class F>
+inline decltype(auto) with_index_width(IndexWidth w, F&& f) {
+    switch (w) {
+        case IndexWidth::I16_C16: return f(TypeTag<uint16_t>{}, TypeTag<uint16_t>{});
+        case IndexWidth::I32_C16: return f(TypeTag<int>{}, TypeTag<uint16_t>{});
+        default:                  return f(TypeTag<int>{}, TypeTag<int>{});
+    }
+}
+
+// Copia de las listas de adyacencia con ids de tipo V
+template <class V>
+inline std::vector<std::vector<V>> narrow_adjacency(const std::vector<std::vector<int>>& adj) {
+    std::vector<std::vector<V>> out(adj.size());
+    for (size_t u = 0; u < adj.size(); ++u) out[u].assign(adj[u].begin(), adj[u].end());
+    return out;
+}
+
+// Listas para el motor con ids de tipo V. Con V = int se mueven desde adj en
+// vez de copiarse (en grafos grandes la copia duplicaba el pico de memoria).
+// Con ids más angostos se convierten fila por fila liberando cada fila de int
+// apenas se copia: el pico queda en el tamaño del grafo de int, no en int +
+// angosto. Mientras el motor corre adj queda vacío; return_adjacency lo
+// reconstruye al terminar (--check, restore_graph).
+template <class V>
+inline void lend_adjacency(std::vector<std::vector<int>>& adj, std::vector<std::vector<V>>& out) {
+    if constexpr (std::is_same_v<V, int>) out.swap(adj);
+    else {
+        out.assign(adj.size(), {});
+        for (size_t u = 0; u < adj.size(); ++u) {
+            out[u].assign(adj[u].begin(), adj[u].end());
+            std::vector<int>().swap(adj[u]);
+        }
+    }
+}
+template <class V>
+inline void return_adjacency(std::vector<std::vector<int>>& adj, std::vector<std::vector<V>>& out) {
+    if constexpr (std::is_same_v<V, int>) adj.swap(out);
+    else {
+        adj.resize(out.size());
+        for (size_t u = 0; u < out.size(); ++u) {
+            adj[u].assign(out[u].begin(), out[u].end());
+            std::vector<V>().swap(out[u]);
+        }
+        out.clear();
+    }
+}
@@ -0,0 +1,249 @@
+// mis.cpp — implementación de libmis (ver mis.hpp).
+// Adaptador delgado sobre los motores de cabecera: les presenta mis::Graph
+// como una vista (sin copiar las listas), conecta time/target/cancel/on_improve a sus ganchos
+// y devuelve la solución como lista de vértices.
+
+#include "mis.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include "../greedy.hpp"
+#include "../SA.hpp"
+#include "../ga/GA.hpp"
+#include "../final/solver_MISP.hpp"
+#include "../bounds.hpp"
+#include "../gen/gnp.hpp"
+
+namespace mis {
+
+// ---------------------------------------------------------------------------
+// Graph
+// ---------------------------------------------------------------------------
+
+void Graph::finalize() {
+    m_ = 0;
+    for (auto& a : adj_) {
+        std::sort(a.begin(), a.end());
+        a.erase(std::unique(a.begin(), a.end()), a.end());
+        m_ += (long long)a.size();
+    }
+    m_ /= 2;
+}
+
+Graph Graph::from_edges(int n, const std::vector<std::pair<int, int>>& edges) {
+    if (n < 0) throw std::runtime_error("mis::Graph: n negativo");
+    Graph G;
+    G.n_ = n;
+    G.adj_.assign(n, {});
+    for (auto [u, v] : edges) {
+        if (u < 0 || v < 0 || u >= n || v >= n)
+            throw std::runtime_error("mis::Graph: índice fuera de rango");
+        if (u == v) continue;
+        G.adj_[u].push_back(v);
+        G.adj_[v].push_back(u);
+    }
+    G.finalize();
+    return G;
+}
+
+Graph Graph::from_csr(int n, const int64_t* offsets, const int* neighbors) {
+    if (n < 0) throw std::runtime_error("mis::Graph: n negativo");
+    Graph G;
+    G.n_ = n;
+    G.adj_.assign(n, {});
+    // Se agregan ambas direcciones: un CSR no simétrico queda simetrizado
+    for (int u = 0; u < n; ++u) {
+        if (offsets[u + 1] < offsets[u]) throw std::runtime_error("mis::Graph: offsets no crecientes");
+        for (int64_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+            const int v = neighbors[k];
+            if (v < 0 || v >= n) throw std::runtime_error("mis::Graph: índice fuera de rango");
+            if (v == u) continue;
+            G.adj_[u].push_back(v);
+            G.adj_[v].push_back(u);
+        }
+    }
+    G.finalize();
+    return G;
+}
+
+Graph Graph::load(const std::string& path) {
+    ga::Graph g;
+    if (!g.load(path)) throw std::runtime_error("No pude leer la instancia: " + path);
+    Graph G;
+    G.n_ = g.n;
+    G.adj_ = std::move(g.adj);
+    G.finalize();
+    return G;
+}
+
+Graph Graph::gnp(int n, double p, uint64_t seed) {
+    GenSpec gs;
+    gs.n = n; gs.p = p; gs.seed = seed;
+    Graph G;
+    G.n_ = n;
+    G.adj_ = gnp_adjacency(gs, &G.m_);
+    return G;
+}
+
+// ---------------------------------------------------------------------------
+// Algoritmos
+// ---------------------------------------------------------------------------
+
+Algorithm parse_algorithm(const std::string& name) {
+    if (name == "greedy") return Algorithm::Greedy;
+    if (name == "prob")   return Algorithm::GreedyRCL;
+    if (name == "sa")     return Algorithm::SA;
+    if (name == "ga")     return Algorithm::GA;
+    if (name == "gals")   return Algorithm::GALS;
+    throw std::runtime_error("Algoritmo desconocido: " + name + " (greedy|prob|sa|ga|gals)");
+}
+
+const char* algorithm_name(Algorithm a) {
+    switch (a) {
+        case Algorithm::Greedy:    return "greedy";
+        case Algorithm::GreedyRCL: return "prob";
+        case Algorithm::SA:        return "sa";
+        case Algorithm::GA:        return "ga";
+        case Algorithm::GALS:      return "gals";
+    }
+    return "?";
+}
+
+bool is_independent_set(const Graph& G, const std::vector<int>& vertices, bool maximal) {
+    std::vector<char> in(G.n(), 0);
+    for (int v : vertices) {
+        if (v < 0 || v >= G.n() || in[v]) return false;
+        in[v] = 1;
+    }
+    for (int v : vertices)
+        for (int w : G.adj()[v]) if (in[w]) return false;
+    if (!maximal) return true;
+    for (int u = 0; u < G.n(); ++u) {
+        if (in[u]) continue;
+        bool blocked = false;
+        for (int w : G.adj()[u]) if (in[w]) { blocked = true; break; }
+        if (!blocked) return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Solver
+// ---------------------------------------------------------------------------
+
+// Vista de mis::Graph para los motores templados en el grafo (greedy.hpp,
+// sa::MIS_SA_T, ga::run_ga, gals::run_ga_ls): G.adj[u] lee Graph::adj() en
+// el lugar, sin la copia O(m) por solve(). degree (SA) y el estado del SA
+// viven en Scratch y se reusan entre llamadas con su capacidad.
+struct AdjRef {
+    const std::vector<std::vector<int>>* rows = nullptr;
+    const std::vector<int>& operator[](size_t u) const { return (*rows)[u]; }
+    size_t size() const { return rows->size(); }
+};
+
+struct GraphView {
+    using vertex_t = int;
+    using count_t = int;
+    int n = 0;
+    long long m = 0;
+    AdjRef adj;
+    std::vector<int> degree;
+
+    void bind(const Graph& G) {
+        n = G.n();
+        m = G.m();
+        adj.rows = &G.adj();
+        degree.resize(n);
+        for (int v = 0; v < n; ++v) degree[v] = (int)G.adj()[v].size();
+    }
+};
+
+struct Solver::Scratch {
+    GraphView view;                                 // dirección fija: el SA guarda una referencia
+    std::unique_ptr<sa::MIS_SA_T<GraphView>> sa;    // se crea en el primer solve() con SA
+};
+
+Solver::Solver(Options o) : opts(std::move(o)), scratch(new Scratch) {}
+Solver::~Solver() = default;
+Solver::Solver(Solver&&) noexcept = default;
+Solver& Solver::operator=(Solver&&) noexcept = default;
+
+template <class Vec>
+static void to_vertices(const Vec& inS, std::vector<int>& out) {
+    out.clear();
+    for (size_t v = 0; v < inS.size(); ++v) if (inS[v]) out.push_back((int)v);
+}
+
+Result Solver::solve(const Graph& G) {
+    Scratch& S = *scratch;
+    const Options& o = opts;
+    Result R;
+
+    if (o.use_upper_bound) R.upper_bound = compute_upper_bounds(G.n(), G.adj()).best();
+    const int stop_at = o.use_upper_bound ? stop_value(R.upper_bound, o.target)
+                                          : (o.target > 0 ? o.target : INT_MAX);
+    const unsigned seed = (unsigned)o.seed;
+
+    S.view.bind(G);
+    const GraphView& V = S.view;
+
+    switch (o.algo) {
+        case Algorithm::Greedy:
+        case Algorithm::GreedyRCL: {
+            GreedyResult g = o.algo == Algorithm::Greedy ? greedy_min_degree(V)
+                                                         : greedy_rcl(V, o.rcl_alpha, seed);
+            R.size = g.size;
+            R.time = g.time;
+            R.vertices = std::move(g.sol);
+            std::sort(R.vertices.begin(), R.vertices.end());
+            if (o.on_improve) o.on_improve(R.size, R.time);
+            break;
+        }
+        case Algorithm::SA: {
+            if (!S.sa) S.sa.reset(new sa::MIS_SA_T<GraphView>(V, o.seed));
+            else S.sa->reset(o.seed);
+            sa::MIS_SA_T<GraphView>& M = *S.sa;
+            M.quiet = true;
+            M.stop_flag = o.cancel;
+            M.stop_at = stop_at;
+            M.use_diversification = o.sa.diversify;
+            M.use_adaptive_temp = o.sa.adaptive_temp;
+            M.on_improve = o.on_improve;
+            M.run(o.time_limit, o.sa.T0, o.sa.alpha, o.sa.iters_per_T);
+            R.size = M.best_size;
+            R.time = M.best_time;
+            to_vertices(M.best_inS, R.vertices);
+            break;
+        }
+        case Algorithm::GA: {
+            ga::GAParams P;
+            P.pop = o.ga.pop; P.pc = o.ga.pc; P.pm = o.ga.pm; P.elitism = o.ga.elitism;
+            P.stall_gen = o.ga.stall_gen; P.init = o.ga.init; P.ls = o.ga.ls;
+            ga::GAHooks H;
+            H.stop_flag = o.cancel;
+            if (o.on_improve) H.on_improve = [&](int v, double t, const std::vector<uint8_t>&) { o.on_improve(v, t); };
+            ga::GAResult g = ga::run_ga(V, P, o.time_limit, seed, stop_at, H);
+            R.size = g.best_fit;
+            R.time = g.best_time;
+            to_vertices(g.best_sol, R.vertices);
+            break;
+        }
+        case Algorithm::GALS: {
+            gals::GALSParams P;
+            P.pop_size = o.gals.pop_size; P.ls_budget = o.gals.ls_budget; P.ls_freq = o.gals.ls_freq;
+            gals::GALSHooks H;
+            H.stop_flag = o.cancel;
+            if (o.on_improve) H.on_improve = [&](int v, double t, const std::vector<char>&) { o.on_improve(v, t); };
+            gals::GALSResult g = gals::run_ga_ls(V, P, o.time_limit, seed, stop_at, H);
+            R.size = g.best_size;
+            R.time = g.best_time;
+            to_vertices(g.best_sol, R.vertices);
+            break;
+        }
+    }
+    R.reached = R.size >= stop_at;
+    R.cancelled = !R.reached && o.cancel && o.cancel->load(std::memory_order_relaxed);
+    return R;
+}
+
+} // namespace mis
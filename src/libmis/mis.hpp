@@ -0,0 +1,137 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * libmis — API C++ para resolver MIS dentro del proceso (build/libmis.a,
+ * build/libmis.so), sin lanzar los binarios.
+ *
+ *   mis::Graph G = mis::Graph::from_edges(n, edges);     // o load / from_csr / gnp
+ *   mis::Options o;
+ *   o.algo = mis::Algorithm::GA;
+ *   o.time_limit = 2.0;
+ *   o.on_improve = [](int best, double t) { ... };
+ *   mis::Solver S(o);
+ *   mis::Result R = S.solve(G);                           // R.vertices: 0-based
+ *
+ * - Los motores son los mismos de los binarios (greedy.hpp, SA.hpp,
+ *   ga/GA.hpp, final/solver_MISP.hpp); con la misma semilla y parámetros dan
+ *   los mismos valores que build/SA, build/GA, etc.
+ * - Los motores leen Graph::adj() en el lugar (sin copiar el grafo), y un
+ *   Solver reutiliza su memoria de trabajo (grados, estado del SA) entre
+ *   llamadas: resolver muchos grafos chicos en un bucle no paga reservas ni
+ *   copias O(m) por llamada. Un Solver no es reentrante; para resolver
+ *   en paralelo, un Solver por hilo (el Graph sí se puede compartir).
+ * - Control: time_limit, target (parar al alcanzarlo) y cancel (bandera
+ *   atómica que otro hilo puede poner en true); use_upper_bound corta además
+ *   al alcanzar la cota superior de bounds.hpp, como los binarios.
+ * - Errores de entrada (archivo ilegible, índices fuera de rango) lanzan
+ *   std::runtime_error.
+ */
+namespace mis {
+
+// Grafo no dirigido inmutable, 0-based, sin lazos ni aristas repetidas
+class Graph {
+public:
+    Graph() = default;
+
+    static Graph from_edges(int n, const std::vector<std::pair<int, int>>& edges);
+    // CSR simétrico: vecinos de v en neighbors[offsets[v] .. offsets[v+1])
+    static Graph from_csr(int n, const int64_t* offsets, const int* neighbors);
+    // DIMACS ("p edge n m" + "e u v"), "n m" + pares o pares sueltos
+    static Graph load(const std::string& path);
+    // G(n,p) determinista (mismo grafo que mis-gen / --gen n,p,seed)
+    static Graph gnp(int n, double p, uint64_t seed);
+
+    int n() const { return n_; }
+    long long m() const { return m_; }
+    const std::vector<std::vector<int>>& adj() const { return adj_; }
+
+private:
+    int n_ = 0;
+    long long m_ = 0;
+    std::vector<std::vector<int>> adj_;
+    void finalize();   // ordena, deduplica y cuenta aristas
+};
+
+enum class Algorithm { Greedy, GreedyRCL, SA, GA, GALS };
+
+// "greedy" | "prob" | "sa" | "ga" | "gals"; lanza std::runtime_error si no existe
+Algorithm parse_algorithm(const std::string& name);
+const char* algorithm_name(Algorithm a);
+
+struct SAParams {
+    double T0 = 2.0;
+    double alpha = 0.9995;
+    int iters_per_T = 1000;
+    bool diversify = false;
+    bool adaptive_temp = false;
+};
+
+struct GAParams {
+    int pop = 80;
+    double pc = 0.9;
+    double pm = 0.03;
+    int elitism = 2;
+    int stall_gen = 100;
+    std::string init = "mix";   // mix | greedy | random
+    bool ls = true;
+};
+
+struct GALSParams {
+    int pop_size = 40;
+    int ls_budget = 200;
+    int ls_freq = 10;
+};
+
+struct Options {
+    Algorithm algo = Algorithm::SA;
+    double time_limit = 10.0;        // segundos (no aplica a Greedy / GreedyRCL)
+    uint64_t seed = 1;
+    int target = -1;                 // > 0: parar al alcanzar este valor
+    bool use_upper_bound = true;     // parar al alcanzar la cota superior
+    double rcl_alpha = 0.1;          // GreedyRCL
+    SAParams sa;
+    GAParams ga;
+    GALSParams gals;
+    // Any-time: (mejor valor, segundos desde el inicio); lo llama el hilo de solve()
+    std::function<void(int, double)> on_improve;
+    const std::atomic<bool>* cancel = nullptr;
+};
+
+struct Result {
+    int size = 0;
+    double time = 0.0;               // instante de la mejor solución
+    std::vector<int> vertices;       // conjunto independiente, 0-based, creciente
+    int upper_bound = -1;            // -1 si use_upper_bound = false
+    bool reached = false;            // alcanzó target o la cota superior
+    bool cancelled = false;          // terminó por Options::cancel
+};
+
+class Solver {
+public:
+    explicit Solver(Options opts = {});
+    ~Solver();
+    Solver(Solver&&) noexcept;
+    Solver& operator=(Solver&&) noexcept;
+
+    Options& options() { return opts; }
+    const Options& options() const { return opts; }
+
+    Result solve(const Graph& G);
+
+private:
+    struct Scratch;
+    Options opts;
+    std::unique_ptr<Scratch> scratch;
+};
+
+// Comprueba que vertices sea independiente en G (y maximal si se pide)
+bool is_independent_set(const Graph& G, const std::vector<int>& vertices, bool maximal = false);
+
+} // namespace mis
@@ -0,0 +1,138 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include "csr.hpp"
+#include "telemetry.hpp"
+
+/**
+ * MIS maximal en paralelo por rondas de prioridades (Luby / reservas
+ * deterministas de Blelloch) sobre un grafo CSR con std::thread.
+ *
+ * Cada ronda, sobre los vértices vivos:
+ *  1) v entra a S si su clave es menor que la de todos sus vecinos vivos;
+ *  2) v muere si está en S o tiene un vecino en S; los sobrevivientes se
+ *     compactan para la ronda siguiente.
+ * Las fases solo escriben en el propio v y leen lo escrito en la fase
+ * anterior, así que no hay carreras y el resultado depende solo de la semilla
+ * (no del número de hilos).
+ *
+ * Claves:
+ *  - LUBY_RANDOM: hash(v, semilla), biyectivo => sin empates.
+ *  - LUBY_MINDEG: (grado vivo actual, hash). Recalcula el grado residual en
+ *    cada ronda para imitar al greedy secuencial de grado mínimo; solo
+ *    compiten los vértices con grado <= ⌊(1+eps)·δ⌋ (δ = grado vivo mínimo),
+ *    así que más eps = menos rondas y calidad más lejana al secuencial.
+ */
+enum LubyPriority { LUBY_RANDOM = 0, LUBY_MINDEG = 1 };
+
+struct LubyResult {
+    std::vector<char> inS;
+    int size = 0;
+    int rounds = 0;
+};
+
+// splitmix64: mezcla biyectiva de 64 bits
+inline uint64_t luby_hash(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Reparte [0, len) en T bloques contiguos; f(lo, hi, tid). El hilo 0 es el llamador.
+template <class F>
+inline void parallel_for(int T, size_t len, F f) {
+    if (T <= 1 || len < 2048) { f((size_t)0, len, 0); return; }
+    std::vector<std::thread> th;
+    th.reserve(T - 1);
+    const size_t chunk = (len + T - 1) / T;
+    for (int t = 1; t < T; ++t) {
+        size_t lo = std::min(len, chunk * t), hi = std::min(len, lo + chunk);
+        th.emplace_back([=] { f(lo, hi, t); });
+    }
+    f((size_t)0, std::min(len, chunk), 0);
+    for (auto& x : th) x.join();
+}
+
+inline LubyResult parallel_luby(const CSR& G, int threads, uint64_t seed,
+                                LubyPriority prio = LUBY_RANDOM, double eps = 0.5) {
+    const int n = G.n;
+    const int T = std::max(1, threads);
+    LubyResult R;
+    R.inS.assign(n, 0);
+
+    // Leídos por vecino (acceso aleatorio): con --hugepages, en la arena de 2 MB
+    huge::vector<uint64_t> h(n);
+    huge::vector<int> deg(n);
+    huge::vector<char> alive(n, 1);
+    std::vector<int> live(n), next;
+    parallel_for(T, (size_t)n, [&](size_t lo, size_t hi, int) {
+        for (size_t v = lo; v < hi; ++v) {
+            h[v] = luby_hash(seed ^ (uint64_t)v * 0xd1b54a32d192ed03ULL);
+            deg[v] = G.degree((int)v);
+            live[v] = (int)v;
+        }
+    });
+    // (deg, hash) en orden lexicográfico; con LUBY_RANDOM el grado no cuenta
+    auto less = [&](int a, int b) {
+        if (prio == LUBY_MINDEG && deg[a] != deg[b]) return deg[a] < deg[b];
+        return h[a] < h[b];
+    };
+
+    std::vector<std::vector<int>> keep(T);
+    std::vector<int> tmin(T);
+    int thr = INT_MAX;   // grado máximo que compite en la ronda
+    while (!live.empty()) {
+        ++R.rounds;
+        const size_t L = live.size();
+
+        // 0) grado residual y umbral (solo con sesgo de grado mínimo)
+        if (prio == LUBY_MINDEG) {
+            std::fill(tmin.begin(), tmin.end(), INT_MAX);
+            parallel_for(T, L, [&](size_t lo, size_t hi, int t) {
+                for (size_t i = lo; i < hi; ++i) {
+                    int v = live[i], d = 0;
+                    for (const int* w = G.begin(v); w != G.end(v); ++w) d += alive[*w];
+                    deg[v] = d;
+                    tmin[t] = std::min(tmin[t], d);
+                }
+            });
+            int dmin = *std::min_element(tmin.begin(), tmin.end());
+            thr = (int)std::floor((1.0 + eps) * dmin);
+        }
+
+        // 1) mínimos locales (entre los que compiten) entran a S
+        parallel_for(T, L, [&](size_t lo, size_t hi, int) {
+            for (size_t i = lo; i < hi; ++i) {
+                int v = live[i];
+                if (deg[v] > thr) continue;
+                bool win = true;
+                for (const int* w = G.begin(v); w != G.end(v); ++w)
+                    if (alive[*w] && *w != v && deg[*w] <= thr && less(*w, v)) { win = false; break; }
+                if (win) R.inS[v] = 1;
+            }
+        });
+
+        // 2) eliminar S ∪ N(S) y compactar sobrevivientes
+        for (auto& k : keep) k.clear();
+        parallel_for(T, L, [&](size_t lo, size_t hi, int t) {
+            for (size_t i = lo; i < hi; ++i) {
+                int v = live[i];
+                bool dead = R.inS[v];
+                for (const int* w = G.begin(v); !dead && w != G.end(v); ++w) dead = R.inS[*w];
+                if (dead) alive[v] = 0;
+                else keep[t].push_back(v);
+            }
+        });
+        next.clear();
+        for (auto& k : keep) next.insert(next.end(), k.begin(), k.end());
+        live.swap(next);
+    }
+    R.size = (int)std::count(R.inS.begin(), R.inS.end(), 1);
+    TEL_COUNT("luby.rounds", R.rounds);
+    return R;
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * Contadores de hardware con perf_event_open (Linux), para --perf.
+ *
+ * Eventos (solo espacio de usuario, exclude_kernel: funciona con
+ * perf_event_paranoid <= 2):
+ *   cycles, instructions, l1d_misses (lecturas L1D), llc_misses, branch_misses,
+ *   dtlb_misses (lecturas que fallan en el dTLB; ver --hugepages)
+ *
+ *  - PerfProcess: un fd por evento con inherit=1; cuenta el hilo que lo abre
+ *    y los que cree después (pools de --split, portafolio). Lo usan las fases.
+ *  - PerfThread: un grupo por hilo (una sola lectura para los 6 eventos);
+ *    lo usan los bloques cronometrados (reparación, LS).
+ * Si el kernel, el contenedor o la VM no exponen la PMU, open() devuelve
+ * false y error() explica por qué; los eventos que sí abren se reportan y el
+ * resto queda en 0 (available() indica cuáles).
+ */
+struct PerfSample {
+    static constexpr int N = 6;
+    std::array<uint64_t, N> v{};
+    PerfSample& operator+=(const PerfSample& o) {
+        for (int i = 0; i < N; ++i) v[i] += o.v[i];
+        return *this;
+    }
+    PerfSample operator-(const PerfSample& o) const {
+        PerfSample r;
+        for (int i = 0; i < N; ++i) r.v[i] = v[i] - o.v[i];
+        return r;
+    }
+};
+
+inline const char* perf_event_name(int i) {
+    static const char* names[PerfSample::N] = {
+        "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses"};
+    return names[i];
+}
+
+inline void perf_event_attr_for(int i, perf_event_attr& pe) {
+    std::memset(&pe, 0, sizeof(pe));
+    pe.size = sizeof(pe);
+    pe.disabled = 0;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+    switch (i) {
+    case 0: pe.type = PERF_TYPE_HARDWARE; pe.config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case 1: pe.type = PERF_TYPE_HARDWARE; pe.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case 2:
+        pe.type = PERF_TYPE_HW_CACHE;
+        pe.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case 3: pe.type = PERF_TYPE_HARDWARE; pe.config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case 4: pe.type = PERF_TYPE_HARDWARE; pe.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    default:
+        pe.type = PERF_TYPE_HW_CACHE;
+        pe.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    }
+}
+
+inline int perf_open(perf_event_attr& pe, int group_fd) {
+    return (int)syscall(SYS_perf_event_open, &pe, 0 /*este hilo*/, -1, group_fd, 0);
+}
+
+class PerfProcess {
+public:
+    ~PerfProcess() {
+        for (int fd : fds) if (fd >= 0) close(fd);
+    }
+    bool open() {
+        bool any = false;
+        for (int i = 0; i < PerfSample::N; ++i) {
+            perf_event_attr pe;
+            perf_event_attr_for(i, pe);
+            pe.inherit = 1;
+            fds[i] = perf_open(pe, -1);
+            if (fds[i] >= 0) any = true;
+            else if (err.empty()) err = std::string(perf_event_name(i)) + ": " + std::strerror(errno);
+        }
+        return any;
+    }
+    bool available(int i) const { return fds[i] >= 0; }
+    const std::string& error() const { return err; }
+    PerfSample read_all() const {
+        PerfSample s;
+        for (int i = 0; i < PerfSample::N; ++i) {
+            uint64_t x = 0;
+            if (fds[i] >= 0 && ::read(fds[i], &x, sizeof(x)) == (ssize_t)sizeof(x)) s.v[i] = x;
+        }
+        return s;
+    }
+private:
+    std::array<int, PerfSample::N> fds{{-1, -1, -1, -1, -1, -1}};
+    std::string err;
+};
+
+class PerfThread {
+public:
+    ~PerfThread() {
+        for (int fd : fds) if (fd >= 0) close(fd);
+    }
+    // Abre el grupo en el hilo que llama; el líder es el primer evento que abre
+    bool open() {
+        for (int i = 0; i < PerfSample::N; ++i) {
+            perf_event_attr pe;
+            perf_event_attr_for(i, pe);
+            pe.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+            fds[i] = perf_open(pe, leader);
+            if (fds[i] < 0) continue;
+            if (leader < 0) leader = fds[i];
+            ioctl(fds[i], PERF_EVENT_IOC_ID, &ids[i]);
+        }
+        return leader >= 0;
+    }
+    bool ok() const { return leader >= 0; }
+    PerfSample read_all() const {
+        PerfSample s;
+        if (leader < 0) return s;
+        struct { uint64_t nr; struct { uint64_t value, id; } e[PerfSample::N]; } buf;
+        if (::read(leader, &buf, sizeof(buf)) <= 0) return s;
+        for (uint64_t k = 0; k < buf.nr && k < (uint64_t)PerfSample::N; ++k)
+            for (int i = 0; i < PerfSample::N; ++i)
+                if (fds[i] >= 0 && ids[i] == buf.e[k].id) s.v[i] = buf.e[k].value;
+        return s;
+    }
+private:
+    std::array<int, PerfSample::N> fds{{-1, -1, -1, -1, -1, -1}};
+    std::array<uint64_t, PerfSample::N> ids{};
+    int leader = -1;
+};
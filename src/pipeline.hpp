@@ -0,0 +1,238 @@
+#pragma once
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "artifact_cache.hpp"
+#include "bounds.hpp"
+#include "checkpoints.hpp"
+#include "components.hpp"
+#include "deadline.hpp"
+#include "hugepages.hpp"
+#include "index_width.hpp"
+#include "reorder.hpp"
+#include "solution_io.hpp"
+#include "telemetry.hpp"
+#include "trace.hpp"
+#include "utils.hpp"
+
+/**
+ * Lo que SA, GA y solver_MISP hacen alrededor del motor, en un solo lugar.
+ *
+ * Las tres CLIs repetían el mismo preprocesamiento y el mismo cierre, y cada
+ * flag nuevo había que copiarlo tres veces. SolverPipeline<Vec> (Vec: el 0/1
+ * por vértice del motor, vector<char> o vector<uint8_t>) lo hace una vez:
+ *
+ *  - prepare(): clave del grafo (graph_content_hash), --best_known
+ *    (BestKnownStore), --cache (ArtifactCache), --init_sol, --reorder
+ *    (Relabeling RL) y las cotas de bounds.hpp; "#reorder: .." y "#ub: ..";
+ *  - start(): reportero any-time (--trace), checkpoints (--report_at) y el
+ *    vigía de -t / SIGINT / SIGTERM (Deadline);
+ *  - improve() / split() / with_width(): mejoras del motor en ids
+ *    originales, --split por componentes y despacho por --width;
+ *  - finish(): línea final, "#convergence", "#hugepages", "#cache",
+ *    "#bound", "#deadline" y "#work" (GA), vuelta a ids originales,
+ *    --best_known y --out_sol; devuelve el código de salida (128 + señal si
+ *    la hubo).
+ *
+ * Cada CLI parsea sus flags a PipelineOptions, carga el grafo y solo arma su
+ * motor.
+ */
+
+// Flags comunes a SA, GA y solver_MISP
+struct PipelineOptions {
+    double tmax = 10.0;          // -t
+    int target = -1;             // --target
+    unsigned seed = 1;           // --seed (semilla de --split)
+    int threads = 1;             // --threads (--split)
+    int exact_max = 64;          // --exact_max (--split)
+    std::string reorder = "none";
+    std::string width = "auto";
+    std::vector<double> report_at;
+    std::string trace;
+    std::string init_sol;
+    std::string best_known;
+    std::string cache;
+    std::string out_sol;
+};
+
+// Resultado de un motor, en sus ids (reetiquetados)
+template <class Vec>
+struct RunResult {
+    int best = 0;
+    double time = 0.0;
+    bool reached = false;        // paró por la cota o --target
+    Vec sol;
+};
+
+// G::degree, si el grafo del motor lo tiene (SA)
+template <class G, class = void>
+struct has_degree : std::false_type {};
+template <class G>
+struct has_degree<G, std::void_t<decltype(std::declval<G&>().degree)>> : std::true_type {};
+
+template <class Vec>
+class SolverPipeline {
+public:
+    BestKnownStore store;
+    ArtifactCache cache;
+    ReorderMode mode = ReorderMode::None;
+    Relabeling RL;               // ids del motor -> originales
+    UpperBounds ub;
+    int stop_at = INT_MAX;       // stop_value(ub, --target)
+    Vec warm;                    // --init_sol / --best_known, ya reetiquetada
+    AnytimeTracker track;
+    AnytimeReporter lines;
+    Deadline deadline;
+    const long long* children = nullptr;  // hijos del GA: "#work: children=.. per_sec=.."
+
+    // fmt: formato del tiempo en las líneas any-time y en la final
+    SolverPipeline(const PipelineOptions& opt, AnytimeReporter::TimeFormat fmt)
+        : track(opt.report_at), lines(fmt, opt.trace), O(opt), fmt(fmt) {}
+
+    // Clave, almacén, caché, arranque en caliente, reetiquetado y cotas
+    void prepare(int n, std::vector<std::vector<int>>& adj) {
+        TEL_PHASE("preprocessing");
+        const double t_key = now_seconds();
+        const uint64_t key = (O.best_known.empty() && O.cache.empty()) ? 0 : graph_content_hash(n, adj);
+        store = BestKnownStore(O.best_known, n, key);
+        cache = ArtifactCache(O.cache, n, key);
+        cache.add_time(now_seconds() - t_key);
+        warm = warm_start<Vec>(O.init_sol, store, n);
+        ReorderReport rr;
+        mode = parse_reorder(O.reorder);
+        RL = cached_reorder_graph(cache, n, adj, mode, &rr);
+        if (!RL.identity())
+            std::cerr << "#reorder: mode=" << O.reorder << " time=" << std::fixed << std::setprecision(4)
+                      << rr.seconds << " gap=" << std::setprecision(1) << rr.gap_before << "->" << rr.gap_after
+                      << std::defaultfloat << std::setprecision(6) << "\n";
+        warm = RL.from_original(warm);
+
+        // Cota superior barata: si best la alcanza no queda nada por mejorar
+        ub = cached_upper_bounds(cache, mode, n, adj);
+        stop_at = stop_value(ub.best(), O.target);
+        std::cerr << "#ub: clique_cover=" << ub.clique_cover
+                  << " matching=" << ub.matching
+                  << " edges=" << ub.edges
+                  << " ub=" << ub.best() << "\n";
+    }
+
+    void start() {
+        lines.start();
+        track.start();
+        t_start = now_seconds();
+        deadline.start(O.tmax);
+    }
+
+    std::atomic<bool>* stop_flag() { return deadline.flag(); }
+
+    // Mejora del motor: sol en sus ids; el hash de --report_at, en originales
+    void improve(int v, double t, const Vec& sol, long long work = -1) {
+        track.improve_with(v, t, [&]() -> const Vec& { return RL.to_original(sol, orig); });
+        lines.push(v, t, work);
+    }
+    // Punto de partida (t = 0): solo a la curva any-time, sin línea en stdout
+    void improve_start(int v, const Vec& sol) {
+        track.improve_with(v, 0.0, [&]() -> const Vec& { return RL.to_original(sol, orig); });
+    }
+
+    // --split: solve_large en cada componente grande, B&B en las pequeñas
+    // (components.hpp) y lo ya cerrado en --cache (ExactMemo)
+    RunResult<Vec> split(int n, const std::vector<std::vector<int>>& adj, const LargeSolver& solve_large) {
+        TEL_PHASE("main_loop");
+        if (!warm.empty()) std::cerr << "#init_sol: ignorada con --split\n";
+        SplitOptions so;
+        so.tmax = O.tmax;
+        so.threads = O.threads;
+        so.exact_max = O.exact_max;
+        so.seed = O.seed;
+        so.stop_at = stop_at;
+        so.stop_flag = deadline.flag();
+        huge::collapse_heap();
+        ExactMemo memo;
+        memo.attach(cache, mode, n, so);
+        SplitResult S = solve_by_components(n, adj, so, solve_large, [&](int best, double t) {
+            track.improve(best, t);
+            lines.push(best, t);
+        });
+        memo.save(cache, mode);
+        std::cerr << "#components: count=" << S.n_components
+                  << " exact=" << S.n_exact
+                  << " large=" << S.n_large
+                  << " largest=" << S.largest
+                  << " proven=" << S.proven << "\n";
+        RunResult<Vec> R;
+        R.best = S.total;
+        R.time = S.best_time;
+        R.reached = S.reached;
+        R.sol.assign(S.sol.begin(), S.sol.end());
+        return R;
+    }
+
+    // run(const GT<V, C>&) con los tipos de --width (index_width.hpp); si no
+    // son los de G, el grafo angosto toma prestadas las listas y las devuelve
+    template <template <class, class> class GT, class G, class F>
+    auto with_width(G& g, F&& run) {
+        const IndexWidth w = pick_index_width(g.n, g.adj, O.width);
+        std::cerr << "#width: ids/conf=" << index_width_name(w) << "\n";
+        return with_index_width(w, [&](auto V, auto C) {
+            using Gw = GT<typename decltype(V)::type, typename decltype(C)::type>;
+            if constexpr (std::is_same_v<Gw, G>) {
+                huge::collapse_heap();
+                return run(static_cast<const G&>(g));
+            } else {
+                Gw narrow;
+                narrow.n = g.n;
+                lend_adjacency(g.adj, narrow.adj);
+                if constexpr (has_degree<G>::value) narrow.degree = g.degree;
+                huge::collapse_heap();
+                auto r = run(static_cast<const Gw&>(narrow));
+                return_adjacency(g.adj, narrow.adj);
+                return r;
+            }
+        });
+    }
+
+    // Cierre de la corrida. check (--check) recibe la solución en ids
+    // originales; si falla, código 2 sin tocar --best_known ni --out_sol
+    int finish(const RunResult<Vec>& R, const std::function<bool(const Vec&)>& check = nullptr) {
+        deadline.finish();
+        TEL_PHASE("output");
+        const double elapsed = now_seconds() - t_start;
+        lines.stop();
+        track.finish();
+        // Línea final (con gap si hay --target), después de vaciar el reportero
+        if (fmt == AnytimeReporter::FIXED6) std::cout << std::fixed << std::setprecision(6);
+        std::cout << R.best << " " << R.time;
+        if (O.target > 0) std::cout << " " << (O.target - R.best);
+        std::cout << std::endl;
+        track.summary(O.target);
+        huge::report();
+        cache.report();
+        std::cerr << "#bound: lb=" << R.best << " ub=" << ub.best()
+                  << " status=" << (R.best >= ub.best() ? "optimal" : R.reached ? "target"
+                                    : deadline.signal() ? "interrupted" : "timeout")
+                  << "\n";
+        deadline.report();
+        if (children)
+            std::cerr << "#work: children=" << *children << " per_sec=" << std::fixed << std::setprecision(0)
+                      << (elapsed > 0 ? *children / elapsed : 0.0) << std::defaultfloat << std::setprecision(6) << "\n";
+        const Vec best = RL.to_original(R.sol);
+        if (check && !check(best)) return 2;
+        store.update(best);
+        if (!O.out_sol.empty()) write_solution_1indexed(O.out_sol, best);
+        return deadline.signal() ? 128 + deadline.signal() : 0;
+    }
+
+private:
+    PipelineOptions O;
+    AnytimeReporter::TimeFormat fmt;
+    double t_start = 0.0;
+    Vec orig;                    // buffer de to_original para improve()
+};
@@ -0,0 +1,245 @@
+// portfolio.cpp
+// Portafolio MIS: SA, GA y GA+LS corriendo en paralelo (un hilo por motor)
+// sobre el mismo grafo y con un único presupuesto de tiempo.
+//
+// CLI:
+//   ./build/MIS-portfolio -i instancia -t segs [--seed s] [--engines sa,ga,gals]
+//                         [--share 0|1] [--target K] [--out_sol ruta.txt]
+//   (--gen n,p,seed en lugar de -i genera un G(n,p) en memoria)
+//
+// - El grafo se parsea una sola vez (lector del GA) y los tres motores, que
+//   están templados en el tipo de grafo, leen las mismas listas (sa::Graph,
+//   que además trae los grados que usa el SA): no hay una copia por motor.
+// - Incumbente global compartido: valor atómico + solución protegida por mutex.
+//   Cada mejora global se imprime como "<best> <time>" (tiempo desde el inicio
+//   del portafolio) y al final se repite la mejor línea (con gap si --target).
+// - --share 1 (por defecto): cuando el incumbente global supera al de un motor,
+//   el SA recalienta desde él y GA / GA+LS lo reciben como migrante.
+// - stderr: "#engine: ..." con el aporte de cada motor y "#bound: ...".
+// - --stats json: línea JSON en stderr con fases, contadores de los tres
+//   motores (sumados) y memoria (telemetry.hpp).
+
+#include <bits/stdc++.h>
+#include "../SA.hpp"
+#include "../ga/GA.hpp"
+#include "../final/solver_MISP.hpp"
+#include "../bounds.hpp"
+#include "../gen/gnp.hpp"
+#include "../telemetry.hpp"
+
+using namespace std;
+
+TEL_DEFINE_ALLOC_HOOKS()
+
+enum Engine { ENG_SA = 0, ENG_GA = 1, ENG_GALS = 2, ENG_COUNT = 3 };
+static const char* ENGINE_NAMES[ENG_COUNT] = {"SA", "GA", "GA+LS"};
+
+struct EngineStats {
+    int own_best = 0;            // mejor valor propio (incluye migrantes)
+    int global_improvements = 0; // veces que mejoró el incumbente global
+    int injections = 0;          // incumbentes recibidos de otros motores
+};
+
+// Incumbente compartido entre hilos
+struct Incumbent {
+    atomic<int> value{0};
+    mutex mtx;
+    vector<char> sol;
+    double time = 0.0;
+    int owner = -1;
+    EngineStats stats[ENG_COUNT];
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    int stop_at = INT_MAX;
+    atomic<bool> stop{false};
+
+    double elapsed() const {
+        return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    }
+
+    // Publica una solución de un motor; solo toma el lock si mejora el global
+    template <class Vec>
+    void publish(int eng, int val, const Vec& s) {
+        if (val <= value.load(memory_order_relaxed)) return;
+        lock_guard<mutex> lk(mtx);
+        if (val <= value.load(memory_order_relaxed)) return;
+        sol.assign(s.begin(), s.end());
+        time = elapsed();
+        owner = eng;
+        stats[eng].global_improvements++;
+        value.store(val, memory_order_release);
+        cout << val << " " << fixed << setprecision(6) << time << "\n" << flush;
+        if (val >= stop_at) stop.store(true);
+    }
+
+    // Copia el incumbente si es mejor que own_best
+    template <class Vec>
+    bool fetch(int eng, int own_best, Vec& out) {
+        if (value.load(memory_order_acquire) <= own_best) return false;
+        lock_guard<mutex> lk(mtx);
+        out.assign(sol.begin(), sol.end());
+        stats[eng].injections++;
+        return true;
+    }
+};
+
+int main(int argc, char** argv){
+    ios::sync_with_stdio(false);
+
+    string instPath, gen, out_sol, engines = "sa,ga,gals", stats;
+    double tmax = -1;
+    unsigned seed = 1;
+    bool share = true;
+    int target = -1;
+
+    for (int i=1;i<argc;i++){
+        string a = argv[i];
+        auto need = [&](int &i){ if(i+1>=argc){ cerr<<"Falta valor para "<<a<<"\n"; exit(1);} };
+        if (a=="-i"){ need(i); instPath = argv[++i]; }
+        else if (a=="--gen"){ need(i); gen = argv[++i]; }
+        else if (a=="-t"){ need(i); tmax = atof(argv[++i]); }
+        else if (a=="--seed"){ need(i); seed = (unsigned)stoul(argv[++i]); }
+        else if (a=="--engines"){ need(i); engines = argv[++i]; }
+        else if (a=="--share"){ need(i); share = (string(argv[++i])!="0"); }
+        else if (a=="--target"){ need(i); target = stoi(argv[++i]); }
+        else if (a=="--out_sol"){ need(i); out_sol = argv[++i]; }
+        else if (a=="--stats"){ need(i); stats = argv[++i]; }
+        else { cerr << "Unknown or incomplete arg: " << a << "\n"; return 1; }
+    }
+    if ((instPath.empty() && gen.empty()) || tmax <= 0.0){
+        cerr << "Uso: ./MIS-portfolio -i instancia.graph|--gen n,p,seed -t segs [--seed s] "
+             << "[--engines sa,ga,gals] [--share 0|1] [--target K] [--out_sol ruta.txt] [--stats json]\n";
+        return 1;
+    }
+    if (!tel::enable("MIS-portfolio", stats)){
+        cerr << "--stats: formato no soportado (solo json)\n";
+        return 1;
+    }
+    bool use[ENG_COUNT] = {false, false, false};
+    {
+        stringstream ss(engines);
+        string tok;
+        while (getline(ss, tok, ',')) {
+            if (tok=="sa") use[ENG_SA] = true;
+            else if (tok=="ga") use[ENG_GA] = true;
+            else if (tok=="gals") use[ENG_GALS] = true;
+            else { cerr << "Motor desconocido: " << tok << "\n"; return 1; }
+        }
+    }
+
+    // ---- Carga única del grafo, compartido por los tres motores
+    sa::Graph G;
+    if (!gen.empty()){
+        GenSpec gs = parse_gen_spec(gen);
+        G.n = gs.n;
+        G.adj = gnp_adjacency(gs);
+    } else {
+        ga::Graph L;
+        if (!L.load(instPath)){
+            cerr << "No pude leer la instancia: " << instPath << "\n";
+            return 2;
+        }
+        G.n = L.n;
+        G.adj = move(L.adj);
+    }
+    TEL_PHASE("preprocessing");
+    G.compute_degrees();
+
+    UpperBounds ub = compute_upper_bounds(G.n, G.adj);
+    cerr << "#ub: clique_cover=" << ub.clique_cover
+         << " matching=" << ub.matching
+         << " edges=" << ub.edges
+         << " ub=" << ub.best() << "\n";
+
+    Incumbent inc;
+    inc.stop_at = stop_value(ub.best(), target);
+    inc.t0 = chrono::steady_clock::now();
+
+    TEL_PHASE("main_loop");
+    vector<thread> threads;
+
+    // ---- SA (parámetros por defecto de build/SA)
+    if (use[ENG_SA]) threads.emplace_back([&]{
+        sa::MIS_SA solver(G, seed);
+        solver.quiet = true;
+        solver.stop_flag = &inc.stop;
+        solver.on_improve = [&](int v, double){
+            inc.stats[ENG_SA].own_best = v;
+            inc.publish(ENG_SA, v, solver.best_inS);
+        };
+        if (share) solver.fetch_incumbent = [&](int own, vector<char>& s){
+            return inc.fetch(ENG_SA, own, s);
+        };
+        solver.run(tmax, 2.0, 0.9995, 1000);
+        inc.stats[ENG_SA].own_best = solver.best_size;
+        inc.publish(ENG_SA, solver.best_size, solver.best_inS);
+    });
+
+    // ---- GA (configuración de irace, ver README §17)
+    if (use[ENG_GA]) threads.emplace_back([&]{
+        ga::GAParams P;
+        P.pop = 129; P.pc = 0.9955; P.pm = 0.1512; P.elitism = 1;
+        P.stall_gen = 101; P.init = "mix"; P.ls = true;
+        ga::GAHooks H;
+        H.stop_flag = &inc.stop;
+        H.on_improve = [&](int v, double, const vector<uint8_t>& s){
+            inc.stats[ENG_GA].own_best = v;
+            inc.publish(ENG_GA, v, s);
+        };
+        if (share) H.fetch_migrant = [&](int own, vector<uint8_t>& s){
+            return inc.fetch(ENG_GA, own, s);
+        };
+        ga::GAResult R = ga::run_ga(G, P, tmax, seed, inc.stop_at, H);
+        inc.stats[ENG_GA].own_best = R.best_fit;
+    });
+
+    // ---- GA+LS (configuración de irace, ver README §25)
+    if (use[ENG_GALS]) threads.emplace_back([&]{
+        gals::GALSParams P;
+        P.pop_size = 79; P.ls_budget = 444; P.ls_freq = 5;
+        gals::GALSHooks H;
+        H.stop_flag = &inc.stop;
+        H.on_improve = [&](int v, double, const vector<char>& s){
+            inc.stats[ENG_GALS].own_best = v;
+            inc.publish(ENG_GALS, v, s);
+        };
+        if (share) H.fetch_migrant = [&](int own, vector<char>& s){
+            return inc.fetch(ENG_GALS, own, s);
+        };
+        gals::GALSResult R = gals::run_ga_ls(G, P, tmax, seed, inc.stop_at, H);
+        inc.stats[ENG_GALS].own_best = R.best_size;
+    });
+
+    for (auto& th : threads) th.join();
+
+    // ---- Salida final + aporte por motor
+    TEL_PHASE("output");
+    const int best = inc.value.load();
+    cout << best << " " << fixed << setprecision(6) << inc.time;
+    if (target > 0) cout << " " << (target - best);
+    cout << "\n" << flush;
+
+    for (int e = 0; e < ENG_COUNT; ++e) {
+        if (!use[e]) continue;
+        cerr << "#engine: name=" << ENGINE_NAMES[e]
+             << " best=" << inc.stats[e].own_best
+             << " global_improvements=" << inc.stats[e].global_improvements
+             << " injections=" << inc.stats[e].injections
+             << " owner=" << (inc.owner == e ? "yes" : "no") << "\n";
+    }
+    cerr << "#bound: lb=" << best << " ub=" << ub.best()
+         << " status=" << (best >= ub.best() ? "optimal" : best >= inc.stop_at ? "target" : "timeout")
+         << "\n";
+
+    if (!out_sol.empty()) {
+        ofstream out(out_sol);
+        bool first = true;
+        for (size_t i = 0; i < inc.sol.size(); ++i) if (inc.sol[i]) {
+            if (!first) out << " ";
+            first = false;
+            out << (i + 1);
+        }
+        out << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Reetiquetado de vértices al cargar (--reorder en SA, GA y solver_MISP).
+ *
+ * Los ids de los .graph son arbitrarios: al recorrer adj[v] en add/remove y
+ * en completar a maximal, los accesos a la palabra de estado de cada vecino
+ * (vertex_state.hpp) saltan por todo el arreglo. Reetiquetar deja cerca, en
+ * memoria, a los vértices vecinos:
+ *
+ *  - degree: grado descendente (los vértices más tocados quedan juntos);
+ *  - bfs:    orden de BFS por componente, desde el menor id sin visitar;
+ *  - rcm:    Cuthill-McKee inverso (BFS desde un vértice de grado mínimo,
+ *            vecinos por grado ascendente, orden final invertido);
+ *  - none:   ids del archivo (por defecto).
+ *
+ * Los motores corren sobre el grafo reetiquetado; las soluciones vuelven a
+ * los ids originales con Relabeling::to_original antes de salir (--out_sol,
+ * --check, hashes de #checkpoint) y entran con from_original (--init_sol).
+ */
+enum class ReorderMode { None, Degree, BFS, RCM };
+
+inline ReorderMode parse_reorder(const std::string& s) {
+    if (s == "none")   return ReorderMode::None;
+    if (s == "degree") return ReorderMode::Degree;
+    if (s == "bfs")    return ReorderMode::BFS;
+    if (s == "rcm")    return ReorderMode::RCM;
+    throw std::runtime_error("--reorder espera degree|rcm|bfs|none: " + s);
+}
+
+inline const char* reorder_name(ReorderMode m) {
+    switch (m) {
+        case ReorderMode::Degree: return "degree";
+        case ReorderMode::BFS:    return "bfs";
+        case ReorderMode::RCM:    return "rcm";
+        default:                  return "none";
+    }
+}
+
+// new_id[viejo] y old_id[nuevo]; vacíos = identidad
+struct Relabeling {
+    std::vector<int> new_id;
+    std::vector<int> old_id;
+
+    bool identity() const { return new_id.empty(); }
+
+    // sol indexada por id nuevo -> indexada por id original
+    template <class Vec>
+    Vec to_original(const Vec& sol) const {
+        if (identity()) return sol;
+        Vec out(sol.size());
+        for (size_t v = 0; v < new_id.size(); ++v) out[v] = sol[new_id[v]];
+        return out;
+    }
+    // sol indexada por id original -> indexada por id nuevo (--init_sol)
+    template <class Vec>
+    Vec from_original(const Vec& sol) const {
+        if (identity() || sol.empty()) return sol;
+        Vec out(sol.size());
+        for (size_t v = 0; v < new_id.size(); ++v) out[new_id[v]] = sol[v];
+        return out;
+    }
+    // Igual que to_original, sin copiar si es la identidad (ganchos on_improve)
+    template <class Vec>
+    const Vec& to_original(const Vec& sol, Vec& buf) const {
+        if (identity()) return sol;
+        buf.resize(sol.size());
+        for (size_t v = 0; v < new_id.size(); ++v) buf[v] = sol[new_id[v]];
+        return buf;
+    }
+};
+
+// Vértices (ids actuales) en el orden nuevo
+inline std::vector<int> vertex_order(int n, const std::vector<std::vector<int>>& adj, ReorderMode mode) {
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    auto deg = [&](int v) { return adj[v].size(); };
+    if (mode == ReorderMode::Degree) {
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return deg(a) > deg(b); });
+        return order;
+    }
+    if (mode != ReorderMode::BFS && mode != ReorderMode::RCM) return order;
+
+    // Semillas: por id (bfs) o por grado ascendente (rcm)
+    std::vector<int> seeds = order;
+    if (mode == ReorderMode::RCM)
+        std::stable_sort(seeds.begin(), seeds.end(), [&](int a, int b) { return deg(a) < deg(b); });
+    std::vector<char> seen(n, 0);
+    std::vector<int> nb;
+    size_t head = 0, tail = 0;
+    for (int s : seeds) {
+        if (seen[s]) continue;
+        seen[s] = 1;
+        order[tail++] = s;
+        while (head < tail) {
+            const int u = order[head++];
+            nb.clear();
+            for (int w : adj[u]) if (!seen[w]) { seen[w] = 1; nb.push_back(w); }
+            if (mode == ReorderMode::RCM)
+                std::stable_sort(nb.begin(), nb.end(), [&](int a, int b) { return deg(a) < deg(b); });
+            for (int w : nb) order[tail++] = w;
+        }
+    }
+    if (mode == ReorderMode::RCM) std::reverse(order.begin(), order.end());
+    return order;
+}
+
+// adj[u] -> adj'[perm[u]] con vecinos perm[w], ordenados. En el lugar: solo
+// se mueven las listas (sin copiar los vecinos).
+inline void permute_adjacency(std::vector<std::vector<int>>& adj, const std::vector<int>& perm) {
+    for (auto& a : adj) {
+        for (int& w : a) w = perm[w];
+        std::sort(a.begin(), a.end());
+    }
+    std::vector<std::vector<int>> out(adj.size());
+    for (size_t u = 0; u < adj.size(); ++u) out[perm[u]] = std::move(adj[u]);
+    adj.swap(out);
+}
+
+// Distancia media |u - w| entre vecinos: cuánto saltan los recorridos de adj
+inline double mean_neighbor_gap(const std::vector<std::vector<int>>& adj) {
+    double sum = 0.0;
+    long long cnt = 0;
+    for (size_t u = 0; u < adj.size(); ++u)
+        for (int w : adj[u]) { sum += std::abs((long long)w - (long long)u); ++cnt; }
+    return cnt ? sum / cnt : 0.0;
+}
+
+struct ReorderReport {
+    double seconds = 0.0;
+    double gap_before = 0.0, gap_after = 0.0;
+};
+
+// Reetiqueta adj en el lugar con un orden ya calculado (order[nuevo] = viejo;
+// p.ej. el guardado en --cache, artifact_cache.hpp)
+inline Relabeling reorder_graph(int n, std::vector<std::vector<int>>& adj, std::vector<int> order,
+                                ReorderReport* rep = nullptr) {
+    Relabeling R;
+    if (rep) rep->gap_before = mean_neighbor_gap(adj);
+    const auto t0 = std::chrono::steady_clock::now();
+    R.old_id = std::move(order);
+    R.new_id.assign(n, 0);
+    for (int k = 0; k < n; ++k) R.new_id[R.old_id[k]] = k;
+    permute_adjacency(adj, R.new_id);
+    if (rep) {
+        rep->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        rep->gap_after = mean_neighbor_gap(adj);
+    }
+    return R;
+}
+
+// Reetiqueta adj en el lugar según mode y devuelve cómo volver a los ids originales
+inline Relabeling reorder_graph(int n, std::vector<std::vector<int>>& adj, ReorderMode mode,
+                                ReorderReport* rep = nullptr) {
+    if (mode == ReorderMode::None) return Relabeling();
+    const auto t0 = std::chrono::steady_clock::now();
+    std::vector<int> order = vertex_order(n, adj, mode);
+    const double t_order = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    Relabeling R = reorder_graph(n, adj, std::move(order), rep);
+    if (rep) rep->seconds += t_order;
+    return R;
+}
+
+// Deshace reorder_graph sobre adj (p.ej. para validar en ids originales)
+inline void restore_graph(std::vector<std::vector<int>>& adj, const Relabeling& R) {
+    if (!R.identity()) permute_adjacency(adj, R.old_id);
+}
@@ -0,0 +1,372 @@
+// mis_server.cpp
+// Servidor local de MIS: proceso persistente que escucha en un socket Unix,
+// guarda los grafos parseados en una caché LRU y resuelve con libmis en un
+// pool fijo de hilos.
+//
+// Uso (CLI):
+//   ./build/mis-server [--socket /tmp/mis.sock] [--workers W] [--cache N]
+//                      [--max_time segs]
+//
+// Protocolo (texto, una línea por mensaje; varias solicitudes por conexión,
+// una en curso a la vez):
+//   -> solve graph=RUTA [algo=sa] [t=10] [seed=1] [target=K] [sol=0|1]
+//   -> solve n=5 edges=0-1,1-2,3-4 [algo=..] ...     (aristas en línea, 0-based)
+//   <- improve <best> <time>          cada mejora, en vivo
+//   <- done <best> <time> ub=.. reached=0|1 cancelled=0|1 cached=0|1 [sol=v1,v2,..]
+//   <- error <mensaje>
+//   -> cancel                         corta la solicitud en curso (responde done)
+//   -> stats   <- stats workers=.. queued=.. running=.. solved=.. cache_graphs=..
+//                       cache_hits=.. cache_misses=..
+//   -> ping    <- pong
+//   -> shutdown                       termina el servidor (como SIGINT/SIGTERM)
+// algo: greedy | prob | sa | ga | gals (parámetros por defecto de cada binario).
+//
+// - Caché: clave = ruta + mtime + tamaño (un archivo modificado se vuelve a
+//   leer); --cache 0 la desactiva. La carga ocurre en el hilo del pool.
+// - Si el cliente cierra la conexión, su solicitud en curso se cancela.
+// - Al terminar se cancelan las solicitudes en curso, se espera a los hilos y
+//   se borra el socket.
+// scripts/mis_client.py es un cliente mínimo.
+
+#include <bits/stdc++.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../libmis/mis.hpp"
+#include "../thread_pool.hpp"
+
+using namespace std;
+
+static volatile sig_atomic_t g_signal = 0;
+static void on_signal(int) { g_signal = 1; }
+
+// ---------------------------------------------------------------------------
+// Caché LRU de grafos
+// ---------------------------------------------------------------------------
+
+class GraphCache {
+public:
+    explicit GraphCache(size_t cap) : cap(cap) {}
+
+    // Grafo de path (lo carga si no está); hit indica si vino de la caché
+    shared_ptr<const mis::Graph> get(const string& path, bool& hit) {
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) throw runtime_error("No pude leer la instancia: " + path);
+        const string key = path + "|" + to_string((long long)st.st_mtime) + "|" + to_string((long long)st.st_size);
+        {
+            lock_guard<mutex> lk(mtx);
+            auto it = index.find(key);
+            if (it != index.end()) {
+                lru.splice(lru.begin(), lru, it->second);
+                ++hits;
+                hit = true;
+                return it->second->second;
+            }
+        }
+        // Fuera del lock: dos cargas simultáneas del mismo archivo son posibles
+        // pero inofensivas (se queda la primera)
+        auto G = make_shared<const mis::Graph>(mis::Graph::load(path));
+        lock_guard<mutex> lk(mtx);
+        ++misses;
+        hit = false;
+        if (cap == 0 || index.count(key)) return G;
+        lru.emplace_front(key, G);
+        index[key] = lru.begin();
+        while (lru.size() > cap) {
+            index.erase(lru.back().first);
+            lru.pop_back();
+        }
+        return G;
+    }
+
+    string stats() {
+        lock_guard<mutex> lk(mtx);
+        return "cache_graphs=" + to_string(lru.size()) + " cache_hits=" + to_string(hits) +
+               " cache_misses=" + to_string(misses);
+    }
+
+private:
+    using Entry = pair<string, shared_ptr<const mis::Graph>>;
+    size_t cap;
+    list<Entry> lru;
+    unordered_map<string, list<Entry>::iterator> index;
+    long long hits = 0, misses = 0;
+    mutex mtx;
+};
+
+// ---------------------------------------------------------------------------
+// Conexión y solicitudes
+// ---------------------------------------------------------------------------
+
+struct Conn {
+    int fd;
+    mutex wmtx;   // escriben el lector y el hilo del pool
+    explicit Conn(int fd) : fd(fd) {}
+
+    bool send_line(const string& s) {
+        lock_guard<mutex> lk(wmtx);
+        const char* p = s.data();
+        size_t left = s.size();
+        while (left > 0) {
+            ssize_t k = ::send(fd, p, left, MSG_NOSIGNAL);
+            if (k < 0 && errno == EINTR) continue;
+            if (k <= 0) return false;
+            p += k;
+            left -= (size_t)k;
+        }
+        return true;
+    }
+};
+
+struct Request {
+    string graph;                       // ruta, o vacío si vienen aristas en línea
+    int n = 0;
+    vector<pair<int, int>> edges;
+    mis::Options opts;
+    bool want_sol = false;
+};
+
+struct Job {
+    atomic<bool> cancel{false};
+    atomic<bool> done{false};
+};
+
+struct Server {
+    GraphCache cache;
+    int workers;
+    double max_time;
+    atomic<int> queued{0}, running{0}, connections{0};
+    atomic<long long> solved{0};
+    unique_ptr<ThreadPool> pool;
+
+    Server(size_t cache_cap, int workers, double max_time)
+        : cache(cache_cap), workers(workers), max_time(max_time), pool(new ThreadPool(workers)) {}
+};
+
+// "0-1,1-2" -> {(0,1), (1,2)}
+static vector<pair<int, int>> parse_edges(const string& s) {
+    vector<pair<int, int>> E;
+    stringstream ss(s);
+    string tok;
+    while (getline(ss, tok, ',')) {
+        if (tok.empty()) continue;
+        size_t dash = tok.find('-');
+        if (dash == string::npos) throw runtime_error("arista inválida: " + tok);
+        E.push_back({stoi(tok.substr(0, dash)), stoi(tok.substr(dash + 1))});
+    }
+    return E;
+}
+
+static Request parse_solve(istringstream& in, double max_time) {
+    Request R;
+    string tok;
+    bool have_edges = false;
+    while (in >> tok) {
+        size_t eq = tok.find('=');
+        if (eq == string::npos) throw runtime_error("se esperaba clave=valor: " + tok);
+        const string k = tok.substr(0, eq), v = tok.substr(eq + 1);
+        try {
+            if (k == "graph") R.graph = v;
+            else if (k == "n") R.n = stoi(v);
+            else if (k == "edges") { R.edges = parse_edges(v); have_edges = true; }
+            else if (k == "algo") R.opts.algo = mis::parse_algorithm(v);
+            else if (k == "t") R.opts.time_limit = stod(v);
+            else if (k == "seed") R.opts.seed = stoull(v);
+            else if (k == "target") R.opts.target = stoi(v);
+            else if (k == "sol") R.want_sol = (v == "1");
+            else throw runtime_error("clave desconocida: " + k);
+        } catch (const invalid_argument&) {
+            throw runtime_error("valor inválido: " + tok);
+        } catch (const out_of_range&) {
+            throw runtime_error("valor fuera de rango: " + tok);
+        }
+    }
+    if (R.graph.empty() && !have_edges && R.n <= 0) throw runtime_error("falta graph=RUTA o n=.. edges=..");
+    if (max_time > 0) R.opts.time_limit = min(R.opts.time_limit, max_time);
+    return R;
+}
+
+// Contadores y estado del trabajo al día antes de la respuesta final: un
+// cliente que lee "done" y pide "stats" o un nuevo "solve" ya lo ve terminado
+static void finish_job(Server& S, Job& J) {
+    --S.running;
+    J.done = true;
+}
+
+// Corre en un hilo del pool; cada hilo reutiliza su Solver (memoria de trabajo)
+static void run_job(Server& S, Conn& C, const Request& R, Job& J) {
+    --S.queued;
+    ++S.running;
+    try {
+        bool hit = false;
+        shared_ptr<const mis::Graph> G;
+        if (!R.graph.empty()) G = S.cache.get(R.graph, hit);
+        else G = make_shared<const mis::Graph>(mis::Graph::from_edges(R.n, R.edges));
+
+        thread_local mis::Solver solver;
+        mis::Options& o = solver.options();
+        o = R.opts;
+        o.cancel = &J.cancel;
+        o.on_improve = [&](int v, double t) {
+            ostringstream os;
+            os << "improve " << v << " " << fixed << setprecision(6) << t << "\n";
+            C.send_line(os.str());
+        };
+        mis::Result res = solver.solve(*G);
+        o.on_improve = nullptr;
+
+        ostringstream os;
+        os << "done " << res.size << " " << fixed << setprecision(6) << res.time
+           << " ub=" << res.upper_bound << " reached=" << res.reached
+           << " cancelled=" << res.cancelled << " cached=" << hit;
+        if (R.want_sol) {
+            os << " sol=";
+            for (size_t i = 0; i < res.vertices.size(); ++i) os << (i ? "," : "") << res.vertices[i];
+        }
+        os << "\n";
+        ++S.solved;
+        finish_job(S, J);
+        C.send_line(os.str());
+    } catch (const exception& e) {
+        finish_job(S, J);
+        C.send_line(string("error ") + e.what() + "\n");
+    }
+}
+
+// Un hilo por conexión: lee líneas y despacha al pool
+static void serve_connection(Server& S, int fd) {
+    auto C = make_shared<Conn>(fd);
+    shared_ptr<Job> job;
+    string buf;
+    char tmp[1 << 16];
+    bool open = true;
+
+    auto handle = [&](const string& line) {
+        istringstream in(line);
+        string cmd;
+        if (!(in >> cmd)) return;
+        if (job && job->done) job.reset();
+        if (cmd == "cancel") {
+            if (job) job->cancel = true;
+        } else if (cmd == "ping") {
+            C->send_line("pong\n");
+        } else if (cmd == "stats") {
+            C->send_line("stats workers=" + to_string(S.workers) + " queued=" + to_string(S.queued.load()) +
+                         " running=" + to_string(S.running.load()) + " solved=" + to_string(S.solved.load()) +
+                         " " + S.cache.stats() + "\n");
+        } else if (cmd == "shutdown") {
+            g_signal = 1;
+        } else if (cmd == "solve") {
+            if (job) { C->send_line("error hay una solicitud en curso en esta conexión\n"); return; }
+            Request R;
+            try {
+                R = parse_solve(in, S.max_time);
+            } catch (const exception& e) {
+                C->send_line(string("error ") + e.what() + "\n");
+                return;
+            }
+            job = make_shared<Job>();
+            ++S.queued;
+            S.pool->submit([&S, C, job = job, R = move(R)] { run_job(S, *C, R, *job); });
+        } else {
+            C->send_line("error comando desconocido: " + cmd + "\n");
+        }
+    };
+
+    while (open) {
+        if (job && job->done) job.reset();
+        if (g_signal) {
+            if (job) job->cancel = true;
+            break;
+        }
+        pollfd p{fd, POLLIN, 0};
+        int r = poll(&p, 1, 100);
+        if (r <= 0) continue;
+        ssize_t k = recv(fd, tmp, sizeof(tmp), 0);
+        if (k < 0 && errno == EINTR) continue;
+        if (k <= 0) {
+            // El cliente se fue: no tiene sentido seguir buscando para él
+            if (job) job->cancel = true;
+            open = false;
+            break;
+        }
+        buf.append(tmp, (size_t)k);
+        size_t pos;
+        while ((pos = buf.find('\n')) != string::npos) {
+            string line = buf.substr(0, pos);
+            buf.erase(0, pos + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            handle(line);
+        }
+    }
+    // El hilo del pool escribe en fd: cerrarlo recién cuando termine
+    while (job && !job->done) this_thread::sleep_for(chrono::milliseconds(10));
+    close(fd);
+    --S.connections;
+}
+
+int main(int argc, char** argv) {
+    ios::sync_with_stdio(false);
+    string sock_path = "/tmp/mis.sock";
+    int workers = max(1, (int)thread::hardware_concurrency());
+    size_t cache_cap = 16;
+    double max_time = 0.0;
+
+    for (int i = 1; i < argc; ++i) {
+        string a = argv[i];
+        if (a == "--socket" && i + 1 < argc) sock_path = argv[++i];
+        else if (a == "--workers" && i + 1 < argc) workers = max(1, stoi(argv[++i]));
+        else if (a == "--cache" && i + 1 < argc) cache_cap = (size_t)max(0, stoi(argv[++i]));
+        else if (a == "--max_time" && i + 1 < argc) max_time = stod(argv[++i]);
+        else {
+            cerr << "Uso: mis-server [--socket /tmp/mis.sock] [--workers W] [--cache N] [--max_time segs]\n";
+            return 1;
+        }
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (sock_path.size() >= sizeof(addr.sun_path)) {
+        cerr << "ERROR: ruta de socket demasiado larga: " << sock_path << "\n";
+        return 1;
+    }
+    strcpy(addr.sun_path, sock_path.c_str());
+
+    int lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (lfd < 0) { perror("socket"); return 1; }
+    unlink(sock_path.c_str());   // restos de un servidor anterior
+    if (bind(lfd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(lfd, 64) != 0) {
+        cerr << "ERROR: no pude escuchar en " << sock_path << ": " << strerror(errno) << "\n";
+        close(lfd);
+        return 1;
+    }
+
+    struct sigaction sa{};
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+
+    Server S(cache_cap, workers, max_time);
+    cerr << "#server: socket=" << sock_path << " workers=" << workers << " cache=" << cache_cap << "\n";
+
+    while (!g_signal) {
+        pollfd p{lfd, POLLIN, 0};
+        if (poll(&p, 1, 200) <= 0) continue;
+        int fd = accept(lfd, nullptr, nullptr);
+        if (fd < 0) continue;
+        ++S.connections;
+        thread([&S, fd] { serve_connection(S, fd); }).detach();
+    }
+
+    close(lfd);
+    unlink(sock_path.c_str());
+    // Los lectores ven g_signal, cancelan su solicitud y cierran
+    while (S.connections.load() > 0) this_thread::sleep_for(chrono::milliseconds(20));
+    S.pool.reset();
+    cerr << "#server: solved=" << S.solved.load() << " " << S.cache.stats() << "\n";
+    return 0;
+}
@@ -0,0 +1,233 @@
+#pragma once
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Soluciones en disco y arranque en caliente (--init_sol / --best_known en
+ * SA, GA y solver_MISP).
+ *
+ * Formato de solución: ids 1-indexed separados por espacios (el de --out_sol
+ * de GA y MIS-exact). Las líneas que empiezan con '#' se ignoran, así que un
+ * archivo del almacén sirve tal cual como --init_sol.
+ *
+ * Almacén de mejores conocidas (--best_known DIR): un archivo por instancia,
+ * DIR/<clave>.sol, con la clave = hash del contenido del grafo ya cargado (n y
+ * el conjunto de aristas, sin importar el orden de las líneas ni el formato
+ * del archivo):
+ *
+ *     # best_known size=K n=N key=<hex>
+ *     3 17 25 ...
+ *
+ *  - load() / warm_start(): la solución guardada, si hay; los solvers
+ *    arrancan desde ella si no se dio --init_sol.
+ *  - offer(): al terminar, si la corrida supera lo guardado, reescribe el
+ *    archivo de forma atómica (temporal + fsync + rename) bajo flock sobre
+ *    DIR/<clave>.lock; dos corridas que terminan a la vez no se pisan y gana
+ *    la mejor. update() hace lo mismo y lo informa en "#best_known: ...".
+ * Todo en ids originales del archivo (antes de --reorder).
+ */
+
+// ids 0-based de un archivo de solución 1-indexed
+inline std::vector<int> read_solution_ids(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("No se pudo abrir: " + path);
+    std::vector<int> ids;
+    std::string line;
+    while (std::getline(in, line)) {
+        const size_t b = line.find_first_not_of(" \t\r");
+        if (b == std::string::npos || line[b] == '#') continue;
+        std::istringstream ss(line);
+        long long x;
+        while (ss >> x) {
+            if (x < 1 || x > 2147483647LL) throw std::runtime_error("id fuera de rango en " + path);
+            ids.push_back((int)(x - 1));
+        }
+        ss.clear();
+        std::string rest;
+        if (ss >> rest) throw std::runtime_error("solución mal formada: " + path);
+    }
+    return ids;
+}
+
+// Pertenencia 0/1 de n vértices; un id >= n es otra instancia: error
+template <class Vec>
+inline Vec read_solution_1indexed(const std::string& path, int n) {
+    Vec inS(n, 0);
+    for (int v : read_solution_ids(path)) {
+        if (v >= n)
+            throw std::runtime_error("solución de otra instancia (id " + std::to_string(v + 1) +
+                                     " > n=" + std::to_string(n) + "): " + path);
+        inS[v] = 1;
+    }
+    return inS;
+}
+
+template <class Vec>
+inline void write_solution_1indexed(std::ostream& out, const Vec& inS) {
+    bool first = true;
+    for (size_t i = 0; i < inS.size(); ++i) {
+        if (!inS[i]) continue;
+        if (!first) out << " ";
+        first = false;
+        out << (i + 1);
+    }
+    out << "\n";
+}
+template <class Vec>
+inline void write_solution_1indexed(const std::string& path, const Vec& inS) {
+    std::ofstream out(path);
+    if (!out) return;
+    write_solution_1indexed(out, inS);
+}
+
+// Hash del grafo independiente del orden: n y suma de mezclas de (min, max) por arista
+template <class Adj>
+inline uint64_t graph_content_hash(int n, const Adj& adj) {
+    auto mix = [](uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    };
+    uint64_t h = mix((uint64_t)n);
+    for (int u = 0; u < n; ++u)
+        for (auto w : adj[u])
+            if ((int)w > u) h += mix(((uint64_t)u << 32) | (uint64_t)w);
+    return mix(h);
+}
+
+class BestKnownStore {
+public:
+    BestKnownStore() = default;
+    // dir vacío: desactivado; key = graph_content_hash del grafo cargado
+    BestKnownStore(const std::string& dir, int n, uint64_t key) : dir_(dir), key_(key), n_(n) {
+        if (dir_.empty()) return;
+        if (mkdir(dir_.c_str(), 0755) != 0 && errno != EEXIST)
+            throw std::runtime_error("--best_known: no se pudo crear " + dir_ + ": " + std::strerror(errno));
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)key_);
+        hex_ = hex;
+        stored_ = stored_size();
+    }
+
+    bool enabled() const { return !dir_.empty(); }
+    const std::string& key() const { return hex_; }
+    int stored() const { return stored_; }   // -1: no hay nada guardado
+    std::string path() const { return dir_ + "/" + hex_ + ".sol"; }
+
+    // Solución guardada (vacía si no hay)
+    template <class Vec>
+    Vec load() const {
+        if (stored_ < 0) return Vec();
+        return read_solution_1indexed<Vec>(path(), n_);
+    }
+
+    // Guarda inS si mejora lo guardado (releído bajo el lock). true si escribió.
+    template <class Vec>
+    bool offer(const Vec& inS) {
+        if (!enabled()) return false;
+        int size = 0;
+        for (size_t v = 0; v < inS.size(); ++v) size += inS[v] ? 1 : 0;
+        const std::string lock = dir_ + "/" + hex_ + ".lock";
+        const int fd = ::open(lock.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) return false;
+        bool wrote = false;
+        if (flock(fd, LOCK_EX) == 0) {
+            stored_ = stored_size();
+            if (size > stored_) {
+                const std::string tmp = path() + ".tmp." + std::to_string(getpid());
+                if (write_file(tmp, size, inS) && std::rename(tmp.c_str(), path().c_str()) == 0) {
+                    stored_ = size;
+                    wrote = true;
+                } else {
+                    std::remove(tmp.c_str());
+                }
+            }
+            flock(fd, LOCK_UN);
+        }
+        ::close(fd);
+        return wrote;
+    }
+
+    // offer() + "#best_known: key=.. stored=.. run=.. updated=yes|no" en stderr
+    template <class Vec>
+    void update(const Vec& inS) {
+        if (!enabled()) return;
+        const int before = stored_;
+        int run = 0;
+        for (size_t v = 0; v < inS.size(); ++v) run += inS[v] ? 1 : 0;
+        const bool wrote = offer(inS);
+        std::cerr << "#best_known: key=" << hex_ << " stored=" << before << " run=" << run
+                  << " updated=" << (wrote ? "yes" : "no") << "\n";
+    }
+
+private:
+    std::string dir_, hex_;
+    uint64_t key_ = 0;
+    int n_ = 0;
+    int stored_ = -1;
+
+    // Tamaño de lo guardado: el de la cabecera, o contando ids; -1 si no hay archivo
+    int stored_size() const {
+        std::ifstream in(path());
+        if (!in) return -1;
+        std::string line;
+        if (std::getline(in, line)) {
+            const size_t p = line.find("size=");
+            if (line.rfind("#", 0) == 0 && p != std::string::npos) return std::atoi(line.c_str() + p + 5);
+        }
+        try {
+            return (int)read_solution_ids(path()).size();
+        } catch (const std::exception&) {
+            return -1;   // ilegible: la próxima mejora lo reemplaza
+        }
+    }
+
+    template <class Vec>
+    bool write_file(const std::string& tmp, int size, const Vec& inS) const {
+        std::ostringstream out;
+        out << "# best_known size=" << size << " n=" << n_ << " key=" << hex_ << "\n";
+        write_solution_1indexed(out, inS);
+        const std::string s = out.str();
+        const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        size_t off = 0;
+        while (off < s.size()) {
+            const ssize_t w = ::write(fd, s.data() + off, s.size() - off);
+            if (w <= 0) { ::close(fd); return false; }
+            off += (size_t)w;
+        }
+        const bool ok = ::fsync(fd) == 0;
+        return ::close(fd) == 0 && ok;
+    }
+};
+
+/**
+ * Solución de arranque en ids originales: --init_sol si se dio, si no la del
+ * almacén (vacía si no hay ninguna). "#init_sol: source=.. size=.." en stderr.
+ */
+template <class Vec>
+inline Vec warm_start(const std::string& init_sol, const BestKnownStore& store, int n) {
+    Vec sol;
+    const char* source = "file";
+    if (!init_sol.empty()) sol = read_solution_1indexed<Vec>(init_sol, n);
+    else if (store.enabled()) { sol = store.load<Vec>(); source = "best_known"; }
+    if (sol.empty()) return sol;
+    int size = 0;
+    for (int v = 0; v < n; ++v) size += sol[v] ? 1 : 0;
+    std::cerr << "#init_sol: source=" << source << " size=" << size << "\n";
+    return sol;
+}
@@ -0,0 +1,370 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <sys/resource.h>
+#include "perf_counters.hpp"
+#include "hugepages.hpp"
+
+/**
+ * Telemetría por fases para todos los binarios (--stats json).
+ *
+ *  - Fases: tel::phase("parse") cierra la fase en curso y abre la siguiente;
+ *    se acumula tiempo de pared y de CPU (del proceso, suma de todos los
+ *    hilos). Solo cuenta el hilo que llamó a enable(): los motores marcan
+ *    "init" / "main_loop" y esas marcas se ignoran cuando corren dentro de
+ *    un pool (--split, portafolio, mis-bench).
+ *  - Contadores: TEL_COUNT("ga.mutation", 1) suma aplicaciones de un
+ *    operador; TEL_TIMED("ga.repair") además mide el tiempo del bloque.
+ *    Ambos cuestan una carga relajada cuando la telemetría está apagada.
+ *  - Memoria: pico de RSS (getrusage) y cantidad / bytes de operator new si
+ *    el .cpp del main invoca TEL_DEFINE_ALLOC_HOOKS() una vez.
+ *  - Al salir del proceso (atexit) se escribe una sola línea JSON en stderr:
+ *      {"binary":"GA","wall_s":..,"cpu_s":..,"phases":{"parse":{"wall_s":..,
+ *       "cpu_s":..},..},"counters":{"ga.repair":{"count":..,"time_s":..},..},
+ *       "peak_rss_kb":..,"allocs":..,"frees":..,"alloc_bytes":..}
+ *    Con --hugepages agrega "hugepages":{"mode":..,"page_kb":..,"arena_mb":..,
+ *    "heap_mb":..,"anon_huge_kb":..} (hugepages.hpp).
+ *
+ *  - --perf (enable(.., perf=true)): además lee contadores de hardware
+ *    (perf_counters.hpp) por fase y por bloque TEL_TIMED, y agrega IPC y
+ *    fallos por unidad de trabajo ("per_op": por movimiento del SA, por hijo
+ *    del GA / GA+LS, por nodo del B&B) sobre el main_loop. Si la PMU no está
+ *    disponible se informa "perf":{"available":false,"error":..} y el resto
+ *    de la línea no cambia.
+ *
+ * Compilando con -DMIS_NO_TELEMETRY (make TELEMETRY=0) los contadores y los
+ * ganchos de memoria desaparecen; las fases y el pico de RSS se mantienen
+ * porque solo se tocan desde el main.
+ */
+namespace tel {
+
+struct Counter {
+    std::atomic<long long> count{0};
+    std::atomic<long long> ns{0};   // solo TEL_TIMED
+    bool timed = false;
+    std::array<std::atomic<uint64_t>, PerfSample::N> perf{};   // solo con --perf
+};
+
+// Inicialización constante: los ganchos de operator new pueden ejecutarse
+// antes que cualquier inicializador dinámico
+inline std::atomic<bool> g_enabled{false};
+inline std::atomic<bool> g_perf{false};
+inline std::atomic<long long> g_allocs{0}, g_frees{0}, g_alloc_bytes{0};
+
+struct State {
+    std::string binary;
+    std::thread::id owner;
+
+    std::mutex mtx;
+    std::deque<std::pair<std::string, Counter>> counters;   // direcciones estables
+    std::map<std::string, Counter*> by_name;
+
+    struct Phase { std::string name; double wall = 0, cpu = 0; PerfSample perf; };
+    std::vector<Phase> phases;                                // orden de aparición
+    int current = -1;
+    double ph_wall = 0, ph_cpu = 0, t0_wall = 0, t0_cpu = 0;
+
+    bool perf_requested = false;
+    PerfProcess perf;
+    PerfSample ph_perf;
+};
+
+inline State& state() {
+    static State* s = new State;   // nunca se destruye: se usa desde atexit
+    return *s;
+}
+
+inline bool enabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+inline double wall_now() {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+inline double cpu_now() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Registro por nombre; se llama una vez por punto de instrumentación (static)
+inline Counter& counter(const char* name, bool timed = false) {
+    State& s = state();
+    std::lock_guard<std::mutex> lk(s.mtx);
+    auto it = s.by_name.find(name);
+    if (it != s.by_name.end()) return *it->second;
+    s.counters.emplace_back(std::piecewise_construct,
+                            std::forward_as_tuple(name), std::forward_as_tuple());
+    Counter* c = &s.counters.back().second;
+    c->timed = timed;
+    s.by_name[name] = c;
+    return *c;
+}
+
+inline void add(const char* name, long long k) {
+    if (!enabled()) return;
+    counter(name).count.fetch_add(k, std::memory_order_relaxed);
+}
+
+// Grupo de contadores del hilo actual (se abre al primer uso)
+inline PerfThread* thread_perf() {
+    thread_local PerfThread pt;
+    thread_local bool opened = false;
+    if (!opened) { opened = true; pt.open(); }
+    return pt.ok() ? &pt : nullptr;
+}
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Counter& c) : c(c), on(enabled()) {
+        if (!on) return;
+        if (g_perf.load(std::memory_order_relaxed) && (pt = thread_perf())) p0 = pt->read_all();
+        t0 = std::chrono::steady_clock::now();
+    }
+    ~ScopedTimer() {
+        if (!on) return;
+        auto dt = std::chrono::steady_clock::now() - t0;
+        c.count.fetch_add(1, std::memory_order_relaxed);
+        c.ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count(),
+                       std::memory_order_relaxed);
+        if (pt) {
+            PerfSample d = pt->read_all() - p0;
+            for (int i = 0; i < PerfSample::N; ++i)
+                c.perf[i].fetch_add(d.v[i], std::memory_order_relaxed);
+        }
+    }
+private:
+    Counter& c;
+    bool on;
+    PerfThread* pt = nullptr;
+    PerfSample p0;
+    std::chrono::steady_clock::time_point t0;
+};
+
+// Cierra la fase en curso (acumulando pared / CPU); requiere s.mtx tomado
+inline void close_phase_locked(State& s, double w, double c, const PerfSample& p) {
+    if (s.current < 0) return;
+    s.phases[s.current].wall += w - s.ph_wall;
+    s.phases[s.current].cpu  += c - s.ph_cpu;
+    s.phases[s.current].perf += p - s.ph_perf;
+    s.current = -1;
+}
+
+inline PerfSample process_perf(const State& s) {
+    return g_perf.load(std::memory_order_relaxed) ? s.perf.read_all() : PerfSample{};
+}
+
+inline void phase(const char* name) {
+    State& s = state();
+    if (!enabled() || std::this_thread::get_id() != s.owner) return;
+    const double w = wall_now(), c = cpu_now();
+    const PerfSample p = process_perf(s);
+    std::lock_guard<std::mutex> lk(s.mtx);
+    close_phase_locked(s, w, c, p);
+    int idx = -1;
+    for (int i = 0; i < (int)s.phases.size(); ++i)
+        if (s.phases[i].name == name) { idx = i; break; }
+    if (idx < 0) { s.phases.push_back({name}); idx = (int)s.phases.size() - 1; }
+    s.current = idx;
+    s.ph_wall = w;
+    s.ph_cpu = c;
+    s.ph_perf = p;
+}
+
+inline void json_string(FILE* f, const std::string& x) {
+    fputc('"', f);
+    for (char ch : x) {
+        if (ch == '"' || ch == '\\') fputc('\\', f);
+        fputc(ch, f);
+    }
+    fputc('"', f);
+}
+
+// "cycles":..,"instructions":..,...,"ipc":.. (divididos por den si den > 0)
+inline void json_perf(FILE* f, const State& s, const PerfSample& p, double den = 0) {
+    fputc('{', f);
+    bool first = true;
+    for (int i = 0; i < PerfSample::N; ++i) {
+        if (!s.perf.available(i)) continue;
+        if (!first) fputc(',', f);
+        first = false;
+        if (den > 0) fprintf(f, "\"%s\":%.4f", perf_event_name(i), p.v[i] / den);
+        else         fprintf(f, "\"%s\":%llu", perf_event_name(i), (unsigned long long)p.v[i]);
+    }
+    if (s.perf.available(0) && s.perf.available(1) && p.v[0] > 0)
+        fprintf(f, "%s\"ipc\":%.4f", first ? "" : ",", (double)p.v[1] / p.v[0]);
+    fputc('}', f);
+}
+
+// Unidades de trabajo para "per_op" (la primera con cuenta > 0 de cada motor)
+inline const char* const* per_op_units() {
+    static const char* units[] = {"sa.moves", "ga.children", "gals.iterations", "exact.nodes", nullptr};
+    return units;
+}
+
+inline void emit() {
+    State& s = state();
+    if (!enabled()) return;
+    const double w = wall_now(), c = cpu_now();
+    const PerfSample p = process_perf(s);
+    g_enabled.store(false);
+    std::lock_guard<std::mutex> lk(s.mtx);
+    close_phase_locked(s, w, c, p);
+    const bool perf_on = g_perf.load();
+
+    rusage ru{};
+    getrusage(RUSAGE_SELF, &ru);
+
+    FILE* f = stderr;
+    fprintf(f, "{\"binary\":");
+    json_string(f, s.binary);
+    fprintf(f, ",\"wall_s\":%.6f,\"cpu_s\":%.6f,\"phases\":{", w - s.t0_wall, c - s.t0_cpu);
+    for (size_t i = 0; i < s.phases.size(); ++i) {
+        if (i) fputc(',', f);
+        json_string(f, s.phases[i].name);
+        fprintf(f, ":{\"wall_s\":%.6f,\"cpu_s\":%.6f", s.phases[i].wall, s.phases[i].cpu);
+        if (perf_on) { fprintf(f, ",\"perf\":"); json_perf(f, s, s.phases[i].perf); }
+        fputc('}', f);
+    }
+    fprintf(f, "},\"counters\":{");
+    bool first = true;
+    for (auto& [name, cnt] : s.by_name) {
+        const long long k = cnt->count.load();
+        if (k == 0) continue;
+        if (!first) fputc(',', f);
+        first = false;
+        json_string(f, name);
+        fprintf(f, ":{\"count\":%lld", k);
+        if (cnt->timed) fprintf(f, ",\"time_s\":%.6f", cnt->ns.load() * 1e-9);
+        if (cnt->timed && perf_on) {
+            PerfSample cp;
+            for (int i = 0; i < PerfSample::N; ++i) cp.v[i] = cnt->perf[i].load();
+            fprintf(f, ",\"perf\":");
+            json_perf(f, s, cp);
+        }
+        fputc('}', f);
+    }
+    fputc('}', f);
+    if (s.perf_requested) {
+        fprintf(f, ",\"perf\":{\"available\":%s", perf_on ? "true" : "false");
+        if (!s.perf.error().empty()) {
+            fprintf(f, ",\"error\":");
+            json_string(f, s.perf.error());
+        }
+        fputc('}', f);
+    }
+    if (perf_on) {
+        const State::Phase* loop = nullptr;
+        for (auto& ph : s.phases) if (ph.name == "main_loop") loop = &ph;
+        fprintf(f, ",\"per_op\":{");
+        bool first_unit = true;
+        for (const char* const* u = per_op_units(); loop && *u; ++u) {
+            auto it = s.by_name.find(*u);
+            if (it == s.by_name.end() || it->second->count.load() == 0) continue;
+            if (!first_unit) fputc(',', f);
+            first_unit = false;
+            json_string(f, *u);
+            fputc(':', f);
+            json_perf(f, s, loop->perf, (double)it->second->count.load());
+        }
+        fputc('}', f);
+    }
+    fprintf(f, ",\"peak_rss_kb\":%ld", (long)ru.ru_maxrss);
+    if (huge::enabled())
+        fprintf(f, ",\"hugepages\":{\"mode\":\"%s\",\"page_kb\":%ld,\"arena_mb\":%.1f,\"heap_mb\":%.1f,\"anon_huge_kb\":%ld}",
+                huge::mode_name(huge::arena().mode()), huge::page_kb(),
+                huge::arena().mapped_bytes() / 1048576.0, huge::heap_collapsed() / 1048576.0,
+                huge::anon_huge_kb());
+#ifndef MIS_NO_TELEMETRY
+    fprintf(f, ",\"allocs\":%lld,\"frees\":%lld,\"alloc_bytes\":%lld",
+            g_allocs.load(), g_frees.load(), g_alloc_bytes.load());
+#endif
+    fprintf(f, "}\n");
+    fflush(f);
+}
+
+/**
+ * Activa la telemetría desde el main (formato de --stats; solo "json").
+ * perf=true (--perf) implica --stats json y abre los contadores de hardware
+ * antes de crear hilos. Devuelve false si el formato no es válido. Abre la
+ * fase "parse" y registra emit() para cuando termine el proceso.
+ */
+inline bool enable(const std::string& binary, std::string format, bool perf = false) {
+    if (perf && format.empty()) format = "json";
+    if (format.empty()) return true;
+    if (format != "json") return false;
+    State& s = state();
+    s.binary = binary;
+    s.owner = std::this_thread::get_id();
+    s.t0_wall = wall_now();
+    s.t0_cpu = cpu_now();
+    s.perf_requested = perf;
+    if (perf && s.perf.open()) g_perf.store(true);
+    g_enabled.store(true);
+    phase("parse");
+    std::atexit(emit);
+    return true;
+}
+
+} // namespace tel
+
+#define TEL_CAT2(a, b) a##b
+#define TEL_CAT(a, b) TEL_CAT2(a, b)
+
+#ifndef MIS_NO_TELEMETRY
+
+#define TEL_COUNT(name, k)                                                   \
+    do {                                                                     \
+        if (::tel::enabled()) {                                              \
+            static ::tel::Counter& tel_c_ = ::tel::counter(name);            \
+            tel_c_.count.fetch_add((k), std::memory_order_relaxed);          \
+        }                                                                    \
+    } while (0)
+
+#define TEL_TIMED(name)                                                      \
+    static ::tel::Counter& TEL_CAT(tel_c_, __LINE__) = ::tel::counter(name, true); \
+    ::tel::ScopedTimer TEL_CAT(tel_t_, __LINE__)(TEL_CAT(tel_c_, __LINE__))
+
+// Reemplazo de operator new / delete que cuenta reservas (una vez por binario).
+// GCC no sabe que este new usa malloc y avisa al liberar con free: se silencia.
+#define TEL_DEFINE_ALLOC_HOOKS()                                             \
+    _Pragma("GCC diagnostic push")                                           \
+    _Pragma("GCC diagnostic ignored \"-Wmismatched-new-delete\"")            \
+    void* operator new(std::size_t sz) {                                     \
+        if (::tel::enabled()) {                                              \
+            ::tel::g_allocs.fetch_add(1, std::memory_order_relaxed);         \
+            ::tel::g_alloc_bytes.fetch_add((long long)sz,                    \
+                                           std::memory_order_relaxed);       \
+        }                                                                    \
+        if (void* p = std::malloc(sz ? sz : 1)) return p;                    \
+        throw std::bad_alloc();                                              \
+    }                                                                        \
+    void operator delete(void* p) noexcept {                                 \
+        if (p && ::tel::enabled())                                           \
+            ::tel::g_frees.fetch_add(1, std::memory_order_relaxed);          \
+        std::free(p);                                                        \
+    }                                                                        \
+    void operator delete(void* p, std::size_t) noexcept { operator delete(p); } \
+    _Pragma("GCC diagnostic pop")
+
+#else
+
+#define TEL_COUNT(name, k) do { } while (0)
+#define TEL_TIMED(name) do { } while (0)
+#define TEL_DEFINE_ALLOC_HOOKS()
+
+#endif
+
+#define TEL_PHASE(name) ::tel::phase(name)
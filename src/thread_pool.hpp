@@ -0,0 +1,75 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * Pool de hilos fijo con cola FIFO compartida.
+ * - submit(f): encola una tarea.
+ * - wait(): bloquea hasta que la cola esté vacía y no haya tareas en curso.
+ * El destructor espera las tareas pendientes y termina los hilos.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads) {
+        if (threads < 1) threads = 1;
+        for (int i = 0; i < threads; ++i)
+            workers.emplace_back([this] { loop(); });
+    }
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            closing = true;
+        }
+        cv_task.notify_all();
+        for (auto& w : workers) w.join();
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return (int)workers.size(); }
+
+    void submit(std::function<void()> f) {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            tasks.push_back(std::move(f));
+        }
+        cv_task.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lk(mtx);
+        cv_idle.wait(lk, [this] { return tasks.empty() && running == 0; });
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mtx;
+    std::condition_variable cv_task, cv_idle;
+    int running = 0;
+    bool closing = false;
+
+    void loop() {
+        while (true) {
+            std::function<void()> f;
+            {
+                std::unique_lock<std::mutex> lk(mtx);
+                cv_task.wait(lk, [this] { return closing || !tasks.empty(); });
+                if (tasks.empty()) return; // closing
+                f = std::move(tasks.front());
+                tasks.pop_front();
+                ++running;
+            }
+            f();
+            {
+                std::lock_guard<std::mutex> lk(mtx);
+                --running;
+                if (tasks.empty() && running == 0) cv_idle.notify_all();
+            }
+        }
+    }
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Salida any-time sin E/S en el hilo de búsqueda.
+ *
+ * El motor (un solo productor; con --split las llamadas ya vienen
+ * serializadas por el lock de components.hpp) encola (tiempo, valor, trabajo)
+ * en un anillo lock-free SPSC; un hilo reportero lo vacía cada ~10 ms y
+ * escribe las líneas "<best> <time>" de siempre en stdout con un solo flush
+ * por tanda. stop() vacía lo pendiente antes de que el main imprima la línea
+ * final, así que el orden de stdout no cambia.
+ *
+ * --trace FILE guarda además cada evento:
+ *   - FILE terminado en .csv: "time,value,work" (texto);
+ *   - otro nombre: binario, cabecera de 8 bytes "MISTRC01" y registros de
+ *     24 bytes little-endian {double time; int64 work; int32 value; int32 0}.
+ *     scripts/trace_to_csv.py lo convierte a CSV.
+ * work = movimientos del SA o hijos generados por GA / GA+LS (-1 si no hay).
+ *
+ * Si el anillo se llena (el reportero no alcanza), el evento se descarta y se
+ * informa "#trace: dropped=K" en stderr; el valor final no se pierde porque
+ * lo imprime el main.
+ */
+struct TraceEvent {
+    double t = 0.0;
+    long long work = -1;
+    int value = 0;
+};
+
+template <class T, size_t Cap>
+class SpscRing {
+    static_assert((Cap & (Cap - 1)) == 0, "Cap debe ser potencia de 2");
+public:
+    bool push(const T& x) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == Cap) return false;
+        buf[h & (Cap - 1)] = x;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    bool pop(T& x) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        x = buf[t & (Cap - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+private:
+    std::vector<T> buf = std::vector<T>(Cap);
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+};
+
+class AnytimeReporter {
+public:
+    // FIXED6: "%d %.6f" (SA, GA); GENERAL: formato por defecto de ostream (solver_MISP)
+    enum TimeFormat { FIXED6, GENERAL };
+
+    explicit AnytimeReporter(TimeFormat fmt = FIXED6, std::string trace_path = "")
+        : fmt(fmt), path(std::move(trace_path)) {}
+    ~AnytimeReporter() { stop(); }
+    AnytimeReporter(const AnytimeReporter&) = delete;
+    AnytimeReporter& operator=(const AnytimeReporter&) = delete;
+
+    void start() {
+        if (!path.empty()) {
+            csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+            out = std::fopen(path.c_str(), csv ? "w" : "wb");
+            if (!out) throw std::runtime_error("No se pudo abrir --trace: " + path);
+            if (csv) std::fputs("time,value,work\n", out);
+            else std::fwrite("MISTRC01", 1, 8, out);
+        }
+        worker = std::thread([this] { loop(); });
+    }
+
+    // Productor: nunca bloquea
+    void push(int value, double t, long long work = -1) {
+        if (!ring.push(TraceEvent{t, work, value})) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Vacía lo pendiente y detiene el reportero (idempotente)
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            if (stopping) return;
+            stopping = true;
+        }
+        cv.notify_all();
+        if (worker.joinable()) worker.join();
+        drain();
+        if (out) { std::fclose(out); out = nullptr; }
+        if (const long long k = dropped.load()) std::cerr << "#trace: dropped=" << k << "\n";
+    }
+
+private:
+    SpscRing<TraceEvent, (1 << 16)> ring;
+    TimeFormat fmt;
+    std::string path;
+    bool csv = false;
+    FILE* out = nullptr;
+    std::atomic<long long> dropped{0};
+    std::thread worker;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping = false;
+
+    void drain() {
+        TraceEvent e;
+        bool any = false;
+        while (ring.pop(e)) {
+            any = true;
+            if (fmt == FIXED6) std::cout << e.value << " " << std::fixed << std::setprecision(6) << e.t << '\n';
+            else               std::cout << e.value << " " << std::defaultfloat << e.t << '\n';
+            if (!out) continue;
+            if (csv) {
+                std::fprintf(out, "%.6f,%d,%lld\n", e.t, e.value, e.work);
+            } else {
+                const int64_t w = e.work;
+                const int32_t v = e.value, pad = 0;
+                std::fwrite(&e.t, sizeof(double), 1, out);
+                std::fwrite(&w, sizeof(w), 1, out);
+                std::fwrite(&v, sizeof(v), 1, out);
+                std::fwrite(&pad, sizeof(pad), 1, out);
+            }
+        }
+        if (any) std::cout.flush();
+    }
+
+    void loop() {
+        std::unique_lock<std::mutex> lk(mtx);
+        while (!stopping) {
+            cv.wait_for(lk, std::chrono::milliseconds(10));
+            lk.unlock();
+            drain();
+            lk.lock();
+        }
+    }
+};
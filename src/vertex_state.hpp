@@ -0,0 +1,83 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "hugepages.hpp"
+
+/**
+ * Estado por vértice empaquetado en una sola palabra:
+ *
+ *     word[v] = 2·conf[v] + [v ∈ S]        conf[v] = vecinos de v en S
+ *
+ * Lo usan sa::MIS_SA_T, ga::MISStateT, gals::MISStateT y dyn::DynamicMIS en
+ * lugar de los arreglos paralelos inS/conf. Las preguntas del bucle caliente leen una sola
+ * posición:
+ *  - v libre (fuera de S y sin vecinos en S)  <=>  word[v] == 0
+ *  - v en S                                   <=>  word[v] & 1
+ *  - add(v):    word[v] |= 1  y  word[w] += 2 por cada vecino w
+ *  - remove(v): word[v] &= ~1 y  word[w] -= 2
+ * así add/remove/completar/reparar tocan una línea de caché por vértice en vez
+ * de dos.
+ *
+ * Con --hugepages el arreglo vive en la arena de páginas de 2 MB
+ * (hugepages.hpp).
+ *
+ * W es el count_t del motor (index_width.hpp). Con W de 16 bits conf cabe
+ * hasta 32767; pick_index_width ya elige 32 bits por encima de ese grado.
+ */
+template <class W>
+struct PackedVertexState {
+    huge::vector<W> word;
+
+    void assign(int n) { word.assign(n, W(0)); }
+    void resize(int n) { word.resize(n, W(0)); }   // vértices nuevos: fuera de S, conf 0
+    void clear() { std::fill(word.begin(), word.end(), W(0)); }
+    int n() const { return (int)word.size(); }
+
+    bool in(int v) const { return word[v] & W(1); }
+    int conf(int v) const { return int(word[v] >> 1); }
+    bool is_free(int v) const { return word[v] == W(0); }
+
+    // Nb: lista de vecinos de v (cualquier tipo de id)
+    template <class Nb>
+    void add(int v, const Nb& nb) {
+        word[v] |= W(1);
+        for (auto w : nb) word[w] += W(2);
+    }
+    template <class Nb>
+    void remove(int v, const Nb& nb) {
+        word[v] &= W(~W(1));
+        for (auto w : nb) word[w] -= W(2);
+    }
+
+    // Arista u-v nueva / borrada con S fijo (grafo dinámico, dynamic_mis.hpp)
+    void link(int u, int v) {
+        if (in(u)) word[v] += W(2);
+        if (in(v)) word[u] += W(2);
+    }
+    void unlink(int u, int v) {
+        if (in(u)) word[v] -= W(2);
+        if (in(v)) word[u] -= W(2);
+    }
+
+    int count_in() const {
+        int c = 0;
+        for (W x : word) c += int(x & W(1));
+        return c;
+    }
+
+    // Pertenencia como vector 0/1 (best_inS, Individual, hooks)
+    template <class Vec>
+    void export_membership(Vec& out) const {
+        out.resize(word.size());
+        for (size_t v = 0; v < word.size(); ++v) out[v] = (typename Vec::value_type)(word[v] & W(1));
+    }
+
+    // Carga una pertenencia 0/1 tal cual (sin reparar) y recalcula conf
+    template <class Vec, class Adj>
+    void import_membership(const Vec& in, const Adj& adj) {
+        clear();
+        for (size_t v = 0; v < word.size(); ++v)
+            if (in[v]) add((int)v, adj[v]);
+    }
+};
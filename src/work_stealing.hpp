@@ -0,0 +1,114 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <chrono>
+
+/**
+ * Pool de hilos con robo de trabajo.
+ * - Cada hilo tiene su propia cola: toma tareas del final (LIFO, localidad)
+ *   y, si está vacía, roba del frente de la cola de otro hilo (FIFO).
+ * - submit(f) reparte en round-robin entre las colas; submit(f, w) fija la
+ *   cola w (p.ej. para que las corridas de una instancia queden juntas).
+ * - wait(): bloquea hasta que no queden tareas pendientes ni en curso.
+ * Las colas usan un mutex cada una: las tareas del driver duran segundos, así
+ * que la contención es despreciable frente a una deque lock-free.
+ */
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threads) {
+        if (threads < 1) threads = 1;
+        for (int i = 0; i < threads; ++i) queues.emplace_back(new Queue);
+        for (int i = 0; i < threads; ++i)
+            workers.emplace_back([this, i] { loop(i); });
+    }
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            closing = true;
+        }
+        cv_task.notify_all();
+        for (auto& w : workers) w.join();
+    }
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    int size() const { return (int)workers.size(); }
+    long long steals() const { return n_steals.load(); }
+
+    void submit(std::function<void()> f, int worker = -1) {
+        const int w = (worker >= 0 ? worker : next_queue++) % size();
+        {
+            std::lock_guard<std::mutex> lk(queues[w]->mtx);
+            queues[w]->tasks.push_back(std::move(f));
+        }
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            ++pending;
+        }
+        cv_task.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lk(mtx);
+        cv_idle.wait(lk, [this] { return pending == 0; });
+    }
+
+private:
+    struct Queue {
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+    };
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex mtx;                       // protege pending / closing
+    std::condition_variable cv_task, cv_idle;
+    long long pending = 0;                // encoladas + en curso
+    bool closing = false;
+    std::atomic<unsigned> next_queue{0};
+    std::atomic<long long> n_steals{0};
+
+    bool pop_local(int i, std::function<void()>& f) {
+        std::lock_guard<std::mutex> lk(queues[i]->mtx);
+        if (queues[i]->tasks.empty()) return false;
+        f = std::move(queues[i]->tasks.back());
+        queues[i]->tasks.pop_back();
+        return true;
+    }
+    bool steal(int i, std::function<void()>& f) {
+        const int T = size();
+        for (int k = 1; k < T; ++k) {
+            Queue& q = *queues[(i + k) % T];
+            std::lock_guard<std::mutex> lk(q.mtx);
+            if (q.tasks.empty()) continue;
+            f = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            n_steals++;
+            return true;
+        }
+        return false;
+    }
+
+    void loop(int i) {
+        while (true) {
+            std::function<void()> f;
+            if (pop_local(i, f) || steal(i, f)) {
+                f();
+                std::lock_guard<std::mutex> lk(mtx);
+                if (--pending == 0) cv_idle.notify_all();
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(mtx);
+            if (closing && pending == 0) return;
+            // pending cuenta también las tareas en curso de otros hilos:
+            // se re-chequea con un timeout corto en vez de un aviso por cola
+            cv_task.wait_for(lk, std::chrono::milliseconds(5));
+            if (closing && pending == 0) return;
+        }
+    }
+};